@@ -0,0 +1,339 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    ArchiveScanner.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Game record archive scanner
+ *           Computes win rates by opening, average game length and first
+ *           player advantage per board size over record files, using
+ *           all cores.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <atomic>
+#include <chrono>       // steady_clock
+#include <iomanip>      // std::setw, std::setprecision
+#include <thread>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "ArchiveScanner.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class ArchiveScanner
+ *
+ *  @brief      Instantiates an ArchiveScanner object with empty statistics,
+ *              one thread per core
+ *  @param      -
+ ******************************************************************************/
+
+ArchiveScanner::ArchiveScanner()
+{
+    DEBUG_CONSTRUCTOR;
+
+    siThreads = std::thread::hardware_concurrency();
+    if (siThreads < 1) siThreads = 1;
+
+    bReplay   = false;
+    llBytes   = 0;
+    llErrors  = 0;
+    dRunTime  = 0;
+
+    vecStats.assign (tIndex (BOARD_SLOTS_MAX, BOARD_LINES_MAX) + 1, SIZE_STATS {});
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class ArchiveScanner
+ *
+ *  @brief      Destroys this ArchiveScanner object
+ ******************************************************************************/
+
+ArchiveScanner::~ArchiveScanner()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Stats
+ *
+ *  @brief      Returns statistics of a board size
+ *
+ *  @param      slots, lines : Board size
+ *  @return     Statistics of all scanned games of this board size
+ ******************************************************************************/
+
+const ArchiveScanner::SIZE_STATS& ArchiveScanner::tGet_Stats (short slots, short lines) const
+{
+    return vecStats[tIndex (slots, lines)];
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Threads
+ *
+ *  @brief      Sets number of scanning threads
+ *
+ *  @param      _siThreads : Number of threads (at least 1)
+ *  @return     -
+ ******************************************************************************/
+
+void ArchiveScanner::vSet_Threads (short _siThreads)
+{
+    siThreads = (_siThreads < 1) ? 1 : _siThreads;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Replay
+ *
+ *  @brief      Switches replaying of every game through GameState. The
+ *              replayed result is checked against the recorded result.
+ *
+ *  @param      _bReplay : true  replays games
+ *  @return     -
+ ******************************************************************************/
+
+void ArchiveScanner::vSet_Replay (bool _bReplay)
+{
+    bReplay = _bReplay;
+}
+
+
+/******************************************************************************
+ *  @function   bScan
+ *
+ *  @brief      Adds all games of a record file to the statistics.
+ *              * File is mapped, block headers are indexed
+ *              * Blocks are grouped to chunks of about equal size
+ *              * Threads take the next unscanned chunk until all are done
+ *
+ *  @param      path : Record file
+ *  @return     bool : false  if file can not be mapped or is corrupt
+ *                            (valid blocks are scanned anyway)
+ ******************************************************************************/
+
+bool ArchiveScanner::bScan (const std::string& path)
+{
+    RecordFile                      oFile;
+    std::vector<RecordFile::SPAN>   vecBlocks, vecChunks;
+
+    if (!oFile.bOpen (path)) return false;
+
+    bool valid = oFile.bIndex_Blocks (vecBlocks);
+
+    auto tStart = std::chrono::steady_clock::now();
+
+    // Group blocks to chunks, blocks are adjacent except for headers
+    size_t target = oFile.tGet_Size() / (siThreads * SCAN_CHUNKS_PER_THREAD) + 1;
+
+    for (const RecordFile::SPAN& block : vecBlocks)
+    {
+        if (!vecChunks.empty() && (size_t)(vecChunks.back().end - vecChunks.back().begin) < target)
+             vecChunks.back().end = block.end;
+        else vecChunks.push_back (block);
+    }
+
+    // Scan chunks on all threads, each thread counts separately
+    std::vector<std::vector<SIZE_STATS>> vecThreadStats (siThreads, std::vector<SIZE_STATS> (vecStats.size()));
+    std::vector<std::thread>            vecThreads;
+    std::atomic<size_t>                 next (0);
+
+    for (short t = 0; t < siThreads; t++)
+    {
+        vecThreads.emplace_back ([this, t, &next, &vecChunks, &vecThreadStats]()
+        {
+            for (size_t i = next++; i < vecChunks.size(); i = next++)
+                vScan_Span (vecChunks[i], vecThreadStats[t]);
+        });
+    }
+    for (std::thread& thread : vecThreads)  thread.join();
+
+    // Sum up statistics of all threads
+    for (const auto& stats : vecThreadStats)
+        for (size_t i = 0; i < vecStats.size(); i++)  vAdd (vecStats[i], stats[i]);
+
+    llBytes  += oFile.tGet_Size();
+    dRunTime += std::chrono::duration<double> (std::chrono::steady_clock::now() - tStart).count();
+
+    if (!valid) llErrors++;
+
+    return valid;
+}
+
+
+/******************************************************************************
+ *  @function   vScan_Span
+ *
+ *  @brief      Decodes all records of a chunk in place and counts them
+ *
+ *  @param      span  : Record payload of one or more blocks; block headers
+ *                      between blocks are skipped
+ *              stats : Statistics of the scanning thread
+ *  @return     -
+ ******************************************************************************/
+
+void ArchiveScanner::vScan_Span (const RecordFile::SPAN& span, std::vector<SIZE_STATS>& stats)
+{
+    const unsigned char* pos = span.begin;
+    const unsigned char* block_end;
+    GameRecord           oRecord;
+
+    while (pos < span.end)
+    {
+        // Payload size is in the header in front of each block
+        const unsigned char* header = pos - RECORD_BLOCK_HEADER;
+
+        block_end = pos + (header[4]       | header[5] << 8 |
+                           header[6] << 16 | (size_t)header[7] << 24);
+
+        while (pos < block_end)
+        {
+            size_t used = oRecord.tDecode (pos, block_end - pos, !bReplay);
+
+            if (used == 0) break;       // Rest of block is invalid
+            pos += used;
+
+            GameRecord::BOARD size   = oRecord.tGet_BoardSize();
+            SIZE_STATS&       s      = stats[tIndex (size.slot, size.line)];
+            short             winner = oRecord.siGet_Winner();
+
+            s.games++;
+            s.moves += oRecord.siGet_MoveCount();
+            s.results[winner]++;
+
+            if (winner == oRecord.siGet_StartPlayer())          s.start_wins++;
+            else if (winner != 0 && winner != RECORD_UNFINISHED) s.second_wins++;
+
+            if (oRecord.siGet_MoveCount() > 0)
+            {
+                short opening = oRecord.siGet_Move (0) - 1;
+
+                if      (winner == oRecord.siGet_StartPlayer())   s.opening[opening][0]++;
+                else if (winner == 0 || winner == RECORD_UNFINISHED) s.opening[opening][2]++;
+                else                                              s.opening[opening][1]++;
+            }
+
+            if (bReplay && winner != RECORD_UNFINISHED  &&
+                oRecord.oReplay().siCheck_WinState() != winner)  s.replay_errors++;
+        }
+        pos = block_end + RECORD_BLOCK_HEADER;      // Payload of next block
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vShow_Results
+ *
+ *  @brief      Prints statistics of all board sizes with games
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ArchiveScanner::vShow_Results()
+{
+    long long games = 0;
+
+    for (short slots = BOARD_SLOTS_MIN; slots <= BOARD_SLOTS_MAX; slots++)
+    {
+        for (short lines = BOARD_LINES_MIN; lines <= BOARD_LINES_MAX; lines++)
+        {
+            const SIZE_STATS& s = tGet_Stats (slots, lines);
+
+            if (s.games == 0) continue;
+            games += s.games;
+
+            std::cout << std::fixed << std::setprecision(1)
+                      << "  Board " << slots << "x" << lines << "\n"
+                      << "  Games                : " << s.games << "\n"
+                      << "  Average length       : " << (double)s.moves / s.games << " moves\n"
+                      << "  Won by start player  : " << 100.0 * s.start_wins  / s.games << " %\n"
+                      << "  Won by other player  : " << 100.0 * s.second_wins / s.games << " %\n"
+                      << "  Tie / unfinished     : " << 100.0 * s.results[0] / s.games << " % / "
+                                                     << 100.0 * s.results[RECORD_UNFINISHED] / s.games << " %\n";
+
+            if (bReplay)
+            std::cout << "  Replay errors        : " << s.replay_errors << "\n";
+
+            std::cout << "  Opening  Games       Start won  Other won\n";
+            for (short slot = 0; slot < slots; slot++)
+            {
+                long long n = s.opening[slot][0] + s.opening[slot][1] + s.opening[slot][2];
+
+                if (n == 0) continue;
+                std::cout << "  " << std::setw(5) << slot + 1 << std::setw(9) << n
+                          << std::setw(12) << 100.0 * s.opening[slot][0] / n << " %"
+                          << std::setw(9)  << 100.0 * s.opening[slot][1] / n << " %\n";
+            }
+            std::cout << "\n";
+        }
+    }
+
+    std::cout << "  Games scanned        : " << games << "\n"
+              << "  Bytes scanned        : " << llBytes << "\n"
+              << "  Threads              : " << siThreads << "\n"
+              << "  Run time [s]         : " << std::setprecision(3) << dRunTime << "\n";
+
+    if (dRunTime > 0)
+    std::cout << "  Scan rate [MB/s]     : " << std::setprecision(1) << llBytes / dRunTime / 1e6 << "\n";
+
+    if (llErrors > 0)
+    std::cout << "  Corrupt files        : " << llErrors << "\n";
+
+    std::cout << std::defaultfloat << std::flush;
+}
+
+
+/******************************************************************************
+ *  @function   tIndex
+ *
+ *  @brief      Index of a board size in the statistics
+ *
+ *  @param      slots, lines : Board size
+ *  @return     Index
+ ******************************************************************************/
+
+size_t ArchiveScanner::tIndex (short slots, short lines)
+{
+    return slots * (BOARD_LINES_MAX + 1) + lines;
+}
+
+
+/******************************************************************************
+ *  @function   vAdd
+ *
+ *  @brief      Adds statistics of one board size to another
+ *
+ *  @param      sum : Statistics added to
+ *              add : Statistics added
+ *  @return     -
+ ******************************************************************************/
+
+void ArchiveScanner::vAdd (SIZE_STATS& sum, const SIZE_STATS& add)
+{
+    sum.games         += add.games;
+    sum.moves         += add.moves;
+    sum.start_wins    += add.start_wins;
+    sum.second_wins   += add.second_wins;
+    sum.replay_errors += add.replay_errors;
+
+    for (short i = 0; i < 4; i++)  sum.results[i] += add.results[i];
+
+    for (short slot = 0; slot < BOARD_SLOTS_MAX; slot++)
+        for (short i = 0; i < 3; i++)  sum.opening[slot][i] += add.opening[slot][i];
+}
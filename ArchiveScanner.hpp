@@ -0,0 +1,99 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    ArchiveScanner.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   ArchiveScanner
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _ARCHIVESCANNER_H_
+#define _ARCHIVESCANNER_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*------  Module header includes  -------*/
+#include "RecordFile.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Work splitting  ***/
+#define SCAN_CHUNKS_PER_THREAD  8       // Balances threads on uneven chunks
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Statistics over game record files. Files are mapped into memory,
+ *  split into chunks of whole blocks and scanned in place by all
+ *  threads; every thread counts into its own statistics, which are
+ *  summed up at the end.                                              */
+
+class ArchiveScanner
+{
+    public:
+    /** Types / Structs **/
+        typedef struct
+        {
+            long long   games, moves;
+            long long   results[4];         // Tie, player 1, player 2, unfinished
+            long long   start_wins;         // Won by player who made first move
+            long long   second_wins;        // Won by other player
+            long long   opening[BOARD_SLOTS_MAX][3];    // Per first slot: start player
+                                                        // won, other won, not won
+            long long   replay_errors;      // Replayed result differs from record
+        } SIZE_STATS;
+
+    /** Constructor / Destructor **/
+                 ArchiveScanner();
+        virtual ~ArchiveScanner();
+
+    /** Getter / Setter **/
+        virtual const SIZE_STATS& tGet_Stats    (short slots, short lines) const;
+
+        virtual void    vSet_Threads    (short _siThreads);
+        virtual void    vSet_Replay     (bool _bReplay);
+
+    /** Member functions / methods **/
+        virtual bool    bScan           (const std::string& path);
+        virtual void    vShow_Results   ();
+
+    protected:
+    /** Member functions / methods **/
+        virtual void    vScan_Span      (const RecordFile::SPAN& span,
+                                         std::vector<SIZE_STATS>& stats);
+
+    private:
+    /** Variables **/
+        short       siThreads;
+        bool        bReplay;                // Replay games through GameState
+
+        std::vector<SIZE_STATS> vecStats;   // Per board size
+        long long   llBytes;                // Bytes scanned
+        long long   llErrors;               // Invalid records
+        double      dRunTime;               // Seconds of all scans
+
+    /** Member functions / methods **/
+        static size_t  tIndex           (short slots, short lines);
+        static void    vAdd             (SIZE_STATS& sum, const SIZE_STATS& add);
+};
+
+#endif // _ARCHIVESCANNER_H_
@@ -21,6 +21,12 @@
 #include "main.hpp"
 #include "Board.hpp"
 
+/*=============================================================================
+=====                          STATIC VARIABLES                           =====
+=============================================================================*/
+
+std::vector<FrameBuffer::CELL> Board::aBoardImage[BOARD_SLOTS_MAX + 1][BOARD_LINES_MAX + 1];
+
 /*=============================================================================
 =====                         FUNCTIONS / METHODS                         =====
 =============================================================================*/
@@ -29,7 +35,7 @@
  *  @function   Constructor of class Board
  *
  *  @brief      * Instantiates a Board object
- *              * Inits game board with default values
+ *              * Game state inits game board with default values
  *  @param      -
  ******************************************************************************/
 
@@ -37,10 +43,6 @@ Board::Board()
 {
     DEBUG_CONSTRUCTOR;
 
-    vSet_BoardSize (BOARD {BOARD_SLOTS, BOARD_LINES});
-
-    siWinTokens     = WIN_TOKENS;
-    siWinTokens_Max = std::min (tBoardSize.slot, tBoardSize.line);
     siSlotSelection = 0;
 }
 
@@ -57,147 +59,6 @@ Board::~Board()
 }
 
 
-/******************************************************************************
- *  @function   siGet_WinTokens
- *
- *  @brief      Returns number of tokens to win (token chain length)
- *  @param      -
- *  @return     siWinTokens : Number of tokens to win
- ******************************************************************************/
-
-short Board::siGet_WinTokens()
-{
-    return siWinTokens;
-}
-
-
-/******************************************************************************
- *  @function   siGet_WinTokens_Max
- *
- *  @brief      Returns number of maximum tokens to win (token chain length).
- *              This depends on shortest game board side length (slots or lines)
- *  @param      -
- *  @return     siWinTokens_Max : Number of maximum tokens to win
- ******************************************************************************/
-
-short Board::siGet_WinTokens_Max()
-{
-    return siWinTokens_Max;
-}
-
-
-/******************************************************************************
- *  @function   siGet_Field
- *
- *  @brief      Returns value of a game board field element
- *
- *  @param      _FieldPos : Coordinate of field element as list {slot, line}
- *  @return     vecBoard  : Vector element value of requested field
- ******************************************************************************/
-
-short Board::siGet_Field (BOARD _FieldPos)
-{
-    return vecBoard[_FieldPos.slot][_FieldPos.line];
-}
-
-
-/******************************************************************************
- *  @function   tGet_BoardSize
- *
- *  @brief      Returns current game board size / dimension.
- *  @param      -
- *  @return     tBoardSize : Game board size as list of {slots, lines)
- ******************************************************************************/
-
-Board::BOARD Board::tGet_BoardSize()
-{
-    return tBoardSize;
-}
-
-
-/******************************************************************************
- *  @function   siGet_FreeSlots
- *
- *  @brief      Returns number of slots which are not complete filled with tokens.
- *  @param      -
- *  @return     slot_count : Number of free slots
- ******************************************************************************/
-
-short Board::siGet_FreeSlots()
-{
-    short slot_count = 0;
-
-    // Iterator for outer vector
-    std::vector< std::vector<short> >::iterator slot;
-
-    // Count free slots
-    for (slot = vecBoard.begin(); slot != vecBoard.end(); slot++)
-    {
-        if (*slot->begin() == 0) slot_count++;
-    }
-
-    return slot_count;
-}
-
-
-/******************************************************************************
- *  @function   siGet_FreeSlotNr
- *
- *  @brief      Returns slot number of n-th free slot.
- *              Example:  If slot 1 and 3 are full the 3rd free slot is slot 5
- *  @param      -
- *  @return     slot_nr : Number of n-th free slot
- *
- *  @note       slot_nr == 0 means the game board is full of tokens
- *              and no more moves possible -> end of game
- ******************************************************************************/
-
-short Board::siGet_FreeSlotNr (short nth_freeslot)
-{
-    short slot_nr = 0;
-
-    // Iterator for outer vector
-    std::vector< std::vector<short> >::iterator slot;
-
-    // Search for n-th free slot
-    for (slot = vecBoard.begin(), slot_nr = 1; slot != vecBoard.end(); slot++, slot_nr++)
-    {
-        if (*slot->begin() == 0) nth_freeslot--;
-        if (nth_freeslot   == 0) return slot_nr;
-    }
-    return slot_nr;
-}
-
-
-/******************************************************************************
- *  @function   siGet_FreeFields
- *
- *  @brief      Returns number of game board fields without a token.
- *  @param      -
- *  @return     free_fields : Number of game board fields without a token
- *
- *  @note       free_fields == 0 means the game board is full of tokens
- *              and no more moves possible -> end of game
- ******************************************************************************/
-
-short Board::siGet_FreeFields()
-{
-    short free_fields = 0;
-
-    std::vector< std::vector<short> >::iterator slot;   // Iterator for outer vector
-    std::vector< short              >::iterator line;   // Iterator for inner vector
-
-    // Count free fields  (means number of moves left)
-    for (slot = vecBoard.begin(); slot != vecBoard.end(); slot++)
-    {
-        for (line = slot->begin(); line != slot->end(); line++)
-
-        if (*line == 0) free_fields++;
-    }
-    return free_fields;
-}
-
-
 /******************************************************************************
  *  @function   siGet_SlotSelection
  *
@@ -212,61 +73,6 @@ short Board::siGet_SlotSelection()
 }
 
 
-/******************************************************************************
- *  @function   vSet_WinTokens
- *
- *  @brief      Sets number of tokens to win (token chain length)
- *
- *  @param      vSet_WinTokens : Number of tokens to win
- *  @return     -
- ******************************************************************************/
-
-void Board::vSet_WinTokens (short _siWinTokens)
-{
-    siWinTokens = _siWinTokens;
-}
-
-
-/******************************************************************************
- *  @function   vSet_BoardSize
- *
- *  @brief      Sets game board size / dimension.
- *
- *  @param      _aBoardSize : Game board size as list of {slots, lines)
- *  @return     -
- ******************************************************************************/
-
-void Board::vSet_BoardSize (BOARD _aBoardSize)
-{
-    tBoardSize.slot = _aBoardSize.slot;
-    tBoardSize.line = _aBoardSize.line;
-
-    siWinTokens_Max = std::min (tBoardSize.slot, tBoardSize.line);
-
-    // Set maximum number of tokens to win,
-    // based of shortest game board side length
-    if (siWinTokens_Max < siWinTokens)  siWinTokens = siWinTokens_Max;
-
-    vInit_Board (tBoardSize);   // Recreate game board with new dimensions
-}
-
-
-/******************************************************************************
- *  @function   vSet_Field
- *
- *  @brief      Sets game board flied value.
- *
- *  @param      _aFieldPos : Coordinate of field element as list {slot, line}
- *              val        : Field value that has to be set
- *  @return     -
- ******************************************************************************/
-
-void Board::vSet_Field (BOARD _aFieldPos, short val)
-{
-    vecBoard[_aFieldPos.slot][_aFieldPos.line] = val;
-}
-
-
 /******************************************************************************
  *  @function   vSet_SlotSelection
  *
@@ -283,63 +89,69 @@ void Board::vSet_SlotSelection (short _siSlotSelection)
 
 
 /******************************************************************************
- *  @function   vInit_Board
+ *  @function   vDraw_Board
  *
- *  @brief      Recreate game board 2D vector with new dimensions
+ *  @brief      Prints game board with tokens of the game state.
+ *              The board frame is copied from the pre-rendered image of
+ *              the board size, only token fields are drawn on top.
  *
- *  @param      _BoardSize : Game board dimension as list {slots, lines}
+ *  @param      -
  *  @return     -
- *  @note       Deletion of vector elements will be done by resize(0)
- *              function instead of clear() function.
- *              At program start an empty vector (without elements) will
- *              be declared. Usage of clear() function on an empty vector
- *              leads to an exception.
  ******************************************************************************/
 
-void Board::vInit_Board (BOARD _BoardSize)
+void Board::vDraw_Board()
 {
-    // Delete all vector elements by resize to zero (better than clear() method)
-    vecBoard.resize(0);
-
-    // Initialize board with new dimension and zero values
-    vecBoard.resize(_BoardSize.slot, std::vector<short>(_BoardSize.line, 0));
-}
+    BOARD tBoardSize = oGameState.tGet_BoardSize();
+    COORD tOrigin    = tCurPos_Get();
+    short width      = 3 * tBoardSize.slot + 3;
+    short height     = 2 * tBoardSize.line + 2;
 
+    vPut_Block (vecGet_BoardImage (tBoardSize, siColor_Get()).data(), width, height);
+    oScreen << std::endl;
 
-/******************************************************************************
- *  @function   vClear_Board
- *
- *  @brief      Initiates game board 2D vector elements with zero value
- *
- *  @param      -
- *  @return     -
- ******************************************************************************/
+    // Tokens on fields
+    vColor_Save();
+    for (short slot = 0; slot < tBoardSize.slot; slot++)
+    {
+        for (short line = 0; line < tBoardSize.line; line++)
+        {
+            short field = oGameState.siGet_Field ({slot, line});
 
-void Board::vClear_Board()
-{
-    std::vector< std::vector<short> >::iterator slot;   // Iterator for outer vector
-    std::vector< short              >::iterator line;   // Iterator for inner vector
+            if (field == FIELDVAL_EMPTY) continue;
 
-    // Reset game board 2D vector to zero
-    for (slot = vecBoard.begin(); slot != vecBoard.end(); slot++)
-    {
-        for (line = slot->begin(); line != slot->end(); line++)  *line = 0;
+            vCurPos_Set ({(short)(tOrigin.X + 3 + 3 * slot), (short)(tOrigin.Y + 1 + 2 * line)});
+            vColor_Set  (field == FIELDVAL_HUMAN ? COL_YELLOW : COL_RED);
+            oScreen << "  ";
+        }
     }
+    vColor_Restore();
+
+    vCurPos_Set ({0, (short)(tOrigin.Y + height + 1)});
 }
 
 
 /******************************************************************************
- *  @function   vDraw_Board
+ *  @function   vecGet_BoardImage
  *
- *  @brief      Prints game board
+ *  @brief      Returns pre-rendered board frame of a board size.
+ *              The image is rendered with the first request and kept.
+ *              Token field (slot, line) is at column 3 + 3 * slot,
+ *              row 1 + 2 * line of the image.
  *
- *  @param      -
- *  @return     -
+ *  @param      size  : Board size
+ *              color : Console color of the board
+ *  @return     Cells of image, (3 * slots + 3) x (2 * lines + 2)
  ******************************************************************************/
 
-void Board::vDraw_Board()
+const std::vector<FrameBuffer::CELL>& Board::vecGet_BoardImage (BOARD size, short color)
 {
+    std::vector<FrameBuffer::CELL>& image = aBoardImage[size.slot][size.line];
+
+    if (!image.empty() && image[0].color == color) return image;
+
+    BOARD       tBoardSize = size;
     std::string sBoard_TopLine, sBoard_MidLine, sBoard_BotLine;
+    std::string sImage;
 
 
     /******************************************************************
@@ -365,34 +177,37 @@ void Board::vDraw_Board()
 
 
     /******************************************************************
-    *   Print game board sketch
+    *   Render game board sketch, all rows have the same width
     *******************************************************************/
-    // Draw Game board topline
-    std::cout << sBoard_TopLine  << std::endl;
+    // Game board topline
+    sImage = sBoard_TopLine;
 
-    // Draw Game board lines between top and bottom
+    // Game board lines between top and bottom
     for (short line=0; line < tBoardSize.line; line++)
     {
-        line+1 < 10 ? std::cout << ' ' << line+1 : std::cout << line+1 ;
+        sImage += (line+1 < 10 ? " " : "") + std::to_string (line+1);
 
-        std::cout << char(179);
+        sImage += char(179);
 
         for (short slot=0; slot < tBoardSize.slot; slot++)
         {
-            std::cout << "  "; std::cout << char(179);
+            sImage += "  "; sImage += char(179);
         }
-        std::cout << std::endl;
 
-        if (line < tBoardSize.line-1)   {std::cout << sBoard_MidLine << std::endl;}
+        if (line < tBoardSize.line-1)   {sImage += sBoard_MidLine;}
     }
 
-    // Draw game board bottomline
-    std::cout << sBoard_BotLine << std::endl;
+    // Game board bottomline
+    sImage += sBoard_BotLine;
+
+    // Game board slot numbering
+    sImage += "   ";
+    for (int i=1; i <= tBoardSize.slot; i++)  sImage += std::to_string (i) + (i < 10 ? "  " : " ");
 
-    // Print game board slot and line numbering
-    std::cout << "   ";
-    for (int i=1; i <= tBoardSize.slot; i++)  i < 10 ? std::cout << i << "  " : std::cout << i << " " ;
-    std::cout << std::endl << std::endl;
+    image.resize (sImage.size());
+    for (size_t i = 0; i < sImage.size(); i++)  image[i] = {(unsigned char)sImage[i], (unsigned char)color};
+
+    return image;
 }
 
 
@@ -408,24 +223,26 @@ void Board::vDraw_Board()
 
 void Board::vShow_SlotSelect (short slot, short color)
 {
+    BOARD tBoardSize = oGameState.tGet_BoardSize();
+
     // If no slot selection just clear the slot selection line
-    if (slot == 0) {std::cout << "                         "
+    if (slot == 0) {oScreen << "                         "
                                  "                         " <<
                     std::endl; return;}
 
     // Save current color and clear token
-    vColor_Save(); std::cout << "  ";
+    vColor_Save(); oScreen << "  ";
 
     // Print token above slot with user depending color
     for (int i=1; i <= tBoardSize.slot; i++)
     {
-        std::cout << " ";
+        oScreen << " ";
 
-        if (i == slot) {vColor_Set (color);  std::cout << "  ";}
+        if (i == slot) {vColor_Set (color);  oScreen << "  ";}
 
-        vColor_Restore();  std::cout << "  ";
+        vColor_Restore();  oScreen << "  ";
     }
-    std::cout << std::endl;
+    oScreen << std::endl;
 }
 
 
@@ -439,7 +256,7 @@ void Board::vShow_SlotSelect (short slot, short color)
 
 void Board::vSlotSelect_LShift()
 {
-    siSlotSelection <= 1 ? siSlotSelection = tBoardSize.slot : siSlotSelection--;
+    siSlotSelection <= 1 ? siSlotSelection = oGameState.tGet_BoardSize().slot : siSlotSelection--;
 }
 
 
@@ -453,54 +270,32 @@ void Board::vSlotSelect_LShift()
 
 void Board::vSlotSelect_RShift()
 {
-    siSlotSelection >= tBoardSize.slot  ?  siSlotSelection = 1 : siSlotSelection++;
-}
-
-
-/******************************************************************************
- *  @function   bInsert_Token
- *
- *  @brief      Set field element of game board 2D vector with player ID
- *              value in next free line of selected slot.
- *
- *  @param      player_id : ID value for which player the token has to be set.
- *  @return     bool      : true   if token insert successful
- *                        : false  if slot is full of tokens
- ******************************************************************************/
-
-bool Board::bInsert_Token (short player_id, short slot)
-{
-    slot--;   // Remap slot number to vector index count
-
-    // Search within slot for next free line from bottom to top
-    for (short line = tBoardSize.line - 1; line >= 0; line--)
-    {
-        if   (siGet_Field ({slot, line}) == FIELDVAL_EMPTY)
-        {
-              vSet_Field ({slot, line}, player_id);  return true;
-        }
-    }
-    return false;
+    siSlotSelection >= oGameState.tGet_BoardSize().slot  ?  siSlotSelection = 1 : siSlotSelection++;
 }
 
 
 /******************************************************************************
  *  @function   vAnimate_TokenDrop
  *
- *  @brief      Animates a falling token within a slot.
+ *  @brief      Draws one step of a token falling within a slot.
+ *              The token moves one screen row per step: even steps are
+ *              on the board lines between fields, odd steps on fields.
+ *              Rows passed by the token are restored, so any step can be
+ *              drawn without drawing the steps before. Cursor is
+ *              expected hidden by the caller when the drop starts.
  *
  *  @param      player_id : ID value for which player the falling
  *                          token has to be animated.
+ *              slot      : Slot number (1 ... slots)
+ *              step      : Screen row of token (0 = top board line)
  *  @return     -
  ******************************************************************************/
 
-void Board::vAnimate_TokenDrop (short player_id, short slot)
+void Board::vAnimate_TokenDrop (short player_id, short slot, short step)
 {
     short color;
     char  board_line = char(196);
 
-    vCursor_Visible (false);        // Hide cursor
-
     slot--;                         // Remap slot number to vector index count
 
     // Set token color depending on player
@@ -510,158 +305,14 @@ void Board::vAnimate_TokenDrop (short player_id, short slot)
     vCursor_Move (3, 0);            // Place cursor with X-offset above first slot
     vCursor_Move (slot * 3, -1);    // Move cursor to above selected slot
 
-    // Animated token fall
-    for (short line = 0; line < tBoardSize.line; line++)
+    // Token on row of step, rows above show the empty slot again
+    for (short row = -1; row <= step; row++)
     {
-        vCursor_Move ( 0, +1); vColor_Set(color); std::cout << "  ";       Sleep(14);
-        vCursor_Move (-2, -1); vColor_Restore();  std::cout << "  ";       Sleep(22);
-        vCursor_Move (-2, +2); vColor_Set(color); std::cout << "  ";       Sleep(14);
-        vCursor_Move (-2, -1); vColor_Restore();  std::cout << board_line
-                                                            << board_line; Sleep(22);
-        vCursor_Move (-2, +1);
+        if      (row == step)    {vColor_Set(color); oScreen << "  ";}
+        else if (row % 2 == 0)   {vColor_Restore();  oScreen << board_line << board_line;}
+        else                     {vColor_Restore();  oScreen << "  ";}
 
-        if (siGet_Field ({slot, line}) != FIELDVAL_EMPTY) break;
+        vCursor_Move (-2, +1);
     }
     vColor_Restore();               // Restore console color
 }
-
-
-/******************************************************************************
- *  @function   siCheck_WinState
- *
- *  @brief      Searches for token chain in game board 2D vector which
- *              reached the length of token to win.
- *
- *  @param      -
- *  @return     WON_HUMAN || WON_MACHINE : ID of player that won the game
- *              Zero if no player won, means no token chain had the winning length
- ******************************************************************************/
-
-short Board::siCheck_WinState()
-{
-    short fieldval;
-    short siTokenCnt_H, siTokenCnt_M;
-
-    /******************************************************************
-    *   Check horizontal lines
-    *******************************************************************/
-    for (short line=0; line < tBoardSize.line; line++)
-    {
-        siTokenCnt_H = 0; siTokenCnt_M = 0;     // Reset token counter
-
-        for (short slot=0; slot < tBoardSize.slot; slot++)
-        {
-            fieldval = siGet_Field ({slot, line});
-
-            // Detect a gap in token chain and reset token counter
-            if (fieldval != FIELDVAL_HUMAN   && siTokenCnt_H > 0) siTokenCnt_H = 0;
-            if (fieldval != FIELDVAL_MACHINE && siTokenCnt_M > 0) siTokenCnt_M = 0;
-
-            // Increase token counter if token detected
-            if (fieldval == FIELDVAL_HUMAN)   siTokenCnt_H++;
-            if (fieldval == FIELDVAL_MACHINE) siTokenCnt_M++;
-
-            // Check token chain length and return winner
-            if (siTokenCnt_H == siWinTokens)  return WON_HUMAN;
-            if (siTokenCnt_M == siWinTokens)  return WON_MACHINE;
-        }
-    }
-
-    /******************************************************************
-    *   Check vertical lines
-    *******************************************************************/
-    for (short slot=0; slot < tBoardSize.slot; slot++)
-    {
-        siTokenCnt_H = 0; siTokenCnt_M = 0;     // Reset token counter
-
-        for (short line=0; line < tBoardSize.line; line++)
-        {
-            fieldval = siGet_Field ({slot, line});
-
-            // Detect a gap in token chain and reset token counter
-            if (fieldval != FIELDVAL_HUMAN   && siTokenCnt_H > 0) siTokenCnt_H = 0;
-            if (fieldval != FIELDVAL_MACHINE && siTokenCnt_M > 0) siTokenCnt_M = 0;
-
-            // Increase token counter if token detected
-            if (fieldval == FIELDVAL_HUMAN)   siTokenCnt_H++;
-            if (fieldval == FIELDVAL_MACHINE) siTokenCnt_M++;
-
-            // Check token chain length and return winner
-            if (siTokenCnt_H == siWinTokens)  return WON_HUMAN;
-            if (siTokenCnt_M == siWinTokens)  return WON_MACHINE;
-      }
-    }
-
-    /******************************************************************
-    *   Check diagonal lines  (bottom left -> top right)
-    *******************************************************************/
-    short lines        = tBoardSize.slot + tBoardSize.line - 1;
-    short x_startfield = 0;
-    short y_startfield = tBoardSize.line - 1;
-    short slot, line;
-
-    for (int line_cnt=1; line_cnt <= lines; line_cnt++)
-    {
-        siTokenCnt_H = 0; siTokenCnt_M = 0;             // Reset token counter
-        slot = x_startfield;  line = y_startfield;      // Set start coordinate of first diagonal line
-
-        while (slot >= 0  &&  slot < tBoardSize.slot  &&
-               line >= 0  &&  line < tBoardSize.line)
-        {
-            fieldval = siGet_Field ({slot, line});
-
-            // Detect a gap in token chain and reset token counter
-            if (fieldval != FIELDVAL_HUMAN   && siTokenCnt_H > 0) siTokenCnt_H = 0;
-            if (fieldval != FIELDVAL_MACHINE && siTokenCnt_M > 0) siTokenCnt_M = 0;
-
-            // Increase token counter if token detected
-            if (fieldval == FIELDVAL_HUMAN)   siTokenCnt_H++;
-            if (fieldval == FIELDVAL_MACHINE) siTokenCnt_M++;
-
-            // Check token chain length and return winner
-            if (siTokenCnt_H == siWinTokens)  return WON_HUMAN;
-            if (siTokenCnt_M == siWinTokens)  return WON_MACHINE;
-
-            slot++; line++;   // Increase to next field
-        }
-        // Set start coordinate of next diagonal line
-        y_startfield > 0 ? y_startfield-- : x_startfield++;
-    }
-
-    /******************************************************************
-    *   Check diagonal lines  (top left -> bottom right)
-    *******************************************************************/
-    // Set start coordinate of first diagonal line
-    x_startfield = 0;  y_startfield = 0;
-
-    for (int line_cnt=1; line_cnt <= lines; line_cnt++)
-    {
-        siTokenCnt_H = 0; siTokenCnt_M = 0;             // Reset token counter
-        slot = x_startfield;  line = y_startfield;      // Set start coordinate of first diagonal line
-
-        while (slot >= 0  &&  slot < tBoardSize.slot  &&
-               line >= 0  &&  line < tBoardSize.line)
-        {
-            fieldval = siGet_Field ({slot, line});
-
-            // Detect a gap in token chain and reset token counter
-            if (fieldval != FIELDVAL_HUMAN   && siTokenCnt_H > 0) siTokenCnt_H = 0;
-            if (fieldval != FIELDVAL_MACHINE && siTokenCnt_M > 0) siTokenCnt_M = 0;
-
-            // Increase token counter if token detected
-            if (fieldval == FIELDVAL_HUMAN)   siTokenCnt_H++;
-            if (fieldval == FIELDVAL_MACHINE) siTokenCnt_M++;
-
-            // Check token chain length and return winner
-            if (siTokenCnt_H == siWinTokens)  return WON_HUMAN;
-            if (siTokenCnt_M == siWinTokens)  return WON_MACHINE;
-
-            slot--; line++;   // Increase to next field
-        }
-        // Set start coordinate of next diagonal line
-        x_startfield < tBoardSize.slot - 1 ? x_startfield++ : y_startfield++;
-    }
-
-    return 0;
-}
-
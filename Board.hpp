@@ -29,30 +29,14 @@
 
 /*------  Module header includes  -------*/
 #include "ConsoleControl.hpp"
+#include "GameState.hpp"
 
 /*=============================================================================
 =====                           MACROS / INLINES                          =====
 =============================================================================*/
 
-/***  Game board attributes ***/
-#define BOARD_SLOTS       7
-#define BOARD_LINES       6
-#define WIN_TOKENS        4
-
-#define BOARD_SLOTS_MIN   3
-#define BOARD_SLOTS_MAX   15
-#define BOARD_LINES_MIN   3
-#define BOARD_LINES_MAX   15
-#define WIN_TOKENS_MIN    3
-
-/***  Game board field values  **/
-#define FIELDVAL_EMPTY    0
-#define FIELDVAL_HUMAN    1
-#define FIELDVAL_MACHINE  2
-
-/***  Player wining IDs  ***/
-#define WON_HUMAN   FIELDVAL_HUMAN
-#define WON_MACHINE FIELDVAL_MACHINE
+/***  Token drop animation  ***/
+#define DROP_STEP_MS        36      // Token falls one screen row per step
 
 /*=============================================================================
 =====                               CLASSES                               =====
@@ -67,44 +51,32 @@ class Board : public ConsoleControl
 
     protected:
     /** Types / Structs **/
-        typedef struct {short slot; short line;} BOARD;
+        typedef GameState::BOARD BOARD;
+
+    /** Objects **/
+        GameState   oGameState;     // Rules, position, side to move, history
 
     /** Getter / Setter **/
-        virtual short   siGet_WinTokens     ();
-        virtual short   siGet_WinTokens_Max ();
-        virtual BOARD   tGet_BoardSize      ();
-        virtual short   siGet_Field         (BOARD _FieldPos);
-        virtual short   siGet_FreeSlots     ();
-        virtual short   siGet_FreeSlotNr    (short nth_freeslot);
-        virtual short   siGet_FreeFields    ();
         virtual short   siGet_SlotSelection ();
-
-        virtual void    vSet_WinTokens      (short _siWinTokens);
-        virtual void    vSet_BoardSize      (BOARD _aBoardSize);
-        virtual void    vSet_Field          (BOARD _aFieldPos, short val);
         virtual void    vSet_SlotSelection  (short _siSlotSelection);
 
     /** Further Member functions / methods **/
-        virtual void    vClear_Board        (); // Reset 2D vector (game board) to zero
         virtual void    vDraw_Board         ();
         virtual void    vShow_SlotSelect    (short slot, short color);
 
         virtual void    vSlotSelect_LShift  ();
         virtual void    vSlotSelect_RShift  ();
-        virtual bool    bInsert_Token       (short player_id, short slot);
-        virtual void    vAnimate_TokenDrop  (short player_id, short slot);
-        virtual short   siCheck_WinState    ();
+        virtual void    vAnimate_TokenDrop  (short player_id, short slot, short step);
 
     private:
     /** Variables **/
-        BOARD   tBoardSize;
         short   siSlotSelection;
-        short   siWinTokens, siWinTokens_Max;
 
-        std::vector< std::vector<short> > vecBoard;   // Game board
+        // Pre-rendered board frame (borders, numbering) per board size
+        static std::vector<FrameBuffer::CELL> aBoardImage[BOARD_SLOTS_MAX + 1][BOARD_LINES_MAX + 1];
 
     /** Member functions / methods **/
-        virtual void    vInit_Board         (BOARD _BoardSize);
+        static const std::vector<FrameBuffer::CELL>& vecGet_BoardImage (BOARD size, short color);
 };
 
 #endif // _BOARD_H_
@@ -10,7 +10,11 @@
  *
  *  @brief   Console interface
  *           Provides functionalities to control cursor position
- *           and colored console output
+ *           and colored console output.
+ *           All output is drawn into an off-screen frame buffer first.
+ *           vFlush() emits only the changed region with one console call.
+ *           Console access itself is done by the platform backends
+ *           ConsoleControl_Win.cpp and ConsoleControl_Ansi.cpp
  *
  ******************************************************************************/
 
@@ -22,6 +26,27 @@
 #include "main.hpp"
 #include "ConsoleControl.hpp"
 
+/*=============================================================================
+=====                          STATIC VARIABLES                           =====
+=============================================================================*/
+
+short                        ConsoleControl::siColor_Default = siQuery_Color();
+short                        ConsoleControl::siColor         = siColor_Default;
+COORD                        ConsoleControl::tCurPos         = {0, 0};
+COORD                        ConsoleControl::tCurPos_Shown   = {-1, -1};
+bool                         ConsoleControl::bTurbo          = false;
+bool                         ConsoleControl::bMock           = false;
+ConsoleControl::OUTPUT_STATS ConsoleControl::tStats          = {0, 0, 0};
+
+ConsoleControl::KEY_EVENT    ConsoleControl::aKeyQueue[KEY_QUEUE_SIZE];
+short                        ConsoleControl::siKeyHead       = 0;
+short                        ConsoleControl::siKeyCount      = 0;
+unsigned long long           ConsoleControl::ullKey_Time     = 0;
+
+FrameBuffer                  ConsoleControl::oFrame;
+ConsoleControl::ScreenBuffer ConsoleControl::oScreenBuf;
+std::ostream                 ConsoleControl::oScreen (&oScreenBuf);
+
 /*=============================================================================
 =====                         FUNCTIONS / METHODS                         =====
 =============================================================================*/
@@ -36,6 +61,9 @@
 ConsoleControl::ConsoleControl()
 {
     DEBUG_CONSTRUCTOR;
+
+    console_color = siColor_Default;
+    oFrame.vSet_Blank (siColor_Default);
 }
 
 
@@ -54,17 +82,15 @@ ConsoleControl::~ConsoleControl()
 /******************************************************************************
  *  @function   tCurPos_Get
  *
- *  @brief      Returns current cursor position coordinate
+ *  @brief      Returns current cursor position coordinate.
+ *              Cursor is tracked locally, no console query required.
  *  @param      -
- *  @return     csbi.dwCursorPosition : Cursor coordinate as list {x, y}
+ *  @return     tCurPos : Cursor coordinate as list {x, y}
  ******************************************************************************/
 
 COORD ConsoleControl::tCurPos_Get()
 {
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    GetConsoleScreenBufferInfo (GetStdHandle(STD_OUTPUT_HANDLE), &csbi);
-
-    return (csbi.dwCursorPosition);
+    return tCurPos;
 }
 
 
@@ -79,7 +105,7 @@ COORD ConsoleControl::tCurPos_Get()
 
 void ConsoleControl::vCurPos_Set (COORD pos)
 {
-    SetConsoleCursorPosition (GetStdHandle(STD_OUTPUT_HANDLE), pos);
+    tCurPos = pos;
 }
 
 
@@ -97,32 +123,21 @@ void ConsoleControl::vCurPos_Set (COORD pos)
 
 void ConsoleControl::vCursor_Move (short x, short y)
 {
-    COORD cur_pos = tCurPos_Get();
-
-    cur_pos.X += x;  cur_pos.Y += y;
-
-    vCurPos_Set (cur_pos);
+    tCurPos.X += x;  tCurPos.Y += y;
 }
 
 
 /******************************************************************************
- *  @function   vCursor_Visible
- *
- *  @brief      Hides cursor or makes him visible
+ *  @function   siColor_Get
  *
- *  @param      visible : true   makes cursor visible
- *                        false  hides cursor
- *  @return     -
+ *  @brief      Returns color of next output
+ *  @param      -
+ *  @return     siColor : Console color code
  ******************************************************************************/
 
-void ConsoleControl::vCursor_Visible (bool visible)
+short ConsoleControl::siColor_Get()
 {
-   CONSOLE_CURSOR_INFO cci;
-
-   cci.dwSize   = 10;
-   cci.bVisible = visible;  // Set cursor state visible or invisible
-
-   SetConsoleCursorInfo (GetStdHandle(STD_OUTPUT_HANDLE), &cci);
+    return siColor;
 }
 
 
@@ -137,31 +152,28 @@ void ConsoleControl::vCursor_Visible (bool visible)
 
 void ConsoleControl::vColor_Set (short color)
 {
-    SetConsoleTextAttribute (GetStdHandle(STD_OUTPUT_HANDLE), color);
+    siColor = color;
 }
 
 
 /******************************************************************************
  *  @function   vColor_Save
  *
- *  @brief      Saves current console color to global variable
+ *  @brief      Saves current console color to member variable
  *  @param      -
  *  @return     -
  ******************************************************************************/
 
 void ConsoleControl::vColor_Save()
 {
-    CONSOLE_SCREEN_BUFFER_INFO color;
-    GetConsoleScreenBufferInfo (GetStdHandle(STD_OUTPUT_HANDLE), &color);
-
-    console_color = color.wAttributes;
+    console_color = siColor;
 }
 
 
 /******************************************************************************
  *  @function   vColor_Restore
  *
- *  @brief      Restores console color from global variable
+ *  @brief      Restores console color from member variable
  *  @param      -
  *  @return     -
  ******************************************************************************/
@@ -172,17 +184,341 @@ void ConsoleControl::vColor_Restore()
 }
 
 
+/******************************************************************************
+ *  @function   vPrint
+ *
+ *  @brief      Prints a string at cursor position with current color
+ *  @param      str : String to print, "\n" moves to next line
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vPrint (const std::string str)
+{
+    for (char chr : str)  vPut_Char (chr);
+}
+
+
 /******************************************************************************
  *  @function   vPrintU
  *
- *  @brief      Prints strings as unicode which consists of wide characters
+ *  @brief      Prints strings as unicode which consists of wide characters.
+ *              Characters are mapped to console code page 437.
  *  @param      std::wstring str : String with support of special characters
  *  @return     -
  ******************************************************************************/
 
 void ConsoleControl::vPrintU (const std::wstring str)
 {
-    const wchar_t* wstr = str.c_str();  // Convert string to wide char (unicode)
+    for (wchar_t wchr : str)
+    {
+        switch (wchr)
+        {
+            case L'\u2550' :  vPut_Char (205);  break;   // Double line horizontal
+            case L'\u2551' :  vPut_Char (186);  break;   // Double line vertical
+            case L'\u2554' :  vPut_Char (201);  break;   // Double corner top left
+            case L'\u2557' :  vPut_Char (187);  break;   // Double corner top right
+            case L'\u255A' :  vPut_Char (200);  break;   // Double corner bottom left
+            case L'\u255D' :  vPut_Char (188);  break;   // Double corner bottom right
+            default        :  vPut_Char (wchr < 128 ? wchr : '?');
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vPut_Block
+ *
+ *  @brief      Copies a block of prepared cells into frame at cursor
+ *              position. Cursor moves to begin of line below the block.
+ *
+ *  @param      cells  : Characters and colors, row by row
+ *              width  : Number of columns
+ *              height : Number of rows
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vPut_Block (const FrameBuffer::CELL* cells, short width, short height)
+{
+    for (short row = 0; row < height; row++)
+    {
+        oFrame.vPut_Cells (tCurPos.X, tCurPos.Y + row, cells + row * width, width);
+    }
+    tCurPos = {0, (short)(tCurPos.Y + height)};
+}
+
+
+/******************************************************************************
+ *  @function   vClear_Screen
+ *
+ *  @brief      Clears complete frame and sets cursor to top left corner
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vClear_Screen()
+{
+    oFrame.vClear();
+    tCurPos = {0, 0};
+}
+
+
+/******************************************************************************
+ *  @function   vPut_Char
+ *
+ *  @brief      Writes a character into frame at cursor position
+ *              and moves cursor
+ *  @param      chr : Character (console code page), "\n" moves to next line
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vPut_Char (unsigned char chr)
+{
+    if (chr == '\n') {tCurPos.X = 0;  tCurPos.Y++;  return;}
+
+    oFrame.vPut (tCurPos.X, tCurPos.Y, chr, siColor);
+    tCurPos.X++;
+}
+
+
+/******************************************************************************
+ *  @function   vWait
+ *
+ *  @brief      Shows frame and waits.
+ *              Waiting ends early if a key is pressed, the key stays
+ *              queued. In turbo mode there is no waiting at all.
+ *
+ *  @param      ms : Time to wait in milliseconds
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vWait (short ms)
+{
+    vFlush();
+
+    if (!bTurbo && ms > 0) bKey_Ready (ms);
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Turbo
+ *
+ *  @brief      Switches turbo mode for automated and headless runs:
+ *              no waiting and no animations
+ *
+ *  @param      _bTurbo : true  switches turbo mode on
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vSet_Turbo (bool _bTurbo)
+{
+    bTurbo = _bTurbo;
+}
+
+
+/******************************************************************************
+ *  @function   bGet_Turbo
+ *
+ *  @brief      Returns if turbo mode is active
+ *  @param      -
+ *  @return     bTurbo : true  if turbo mode is active
+ ******************************************************************************/
+
+bool ConsoleControl::bGet_Turbo()
+{
+    return bTurbo;
+}
+
+
+/******************************************************************************
+ *  @function   ullGet_KeyTime
+ *
+ *  @brief      Returns when the key last returned by iRead_Key() was
+ *              queued, so waiting in the queue counts to its latency
+ *  @param      -
+ *  @return     ullKey_Time : Steady clock time [ns]
+ ******************************************************************************/
+
+unsigned long long ConsoleControl::ullGet_KeyTime()
+{
+    return ullKey_Time;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Mock
+ *
+ *  @brief      Switches mock console: frames are encoded like for the
+ *              console and counted, but only kept in the virtual screen
+ *              (shown frame). Has to be set before console is opened.
+ *
+ *  @param      _bMock : true  switches mock console on
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vSet_Mock (bool _bMock)
+{
+    bMock = _bMock;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Stats
+ *
+ *  @brief      Returns output statistics of the console backend
+ *  @param      -
+ *  @return     tStats : Frames emitted, console calls, bytes written
+ ******************************************************************************/
+
+ConsoleControl::OUTPUT_STATS ConsoleControl::tGet_Stats()
+{
+    return tStats;
+}
+
+
+/******************************************************************************
+ *  @function   vReset_Stats
+ *
+ *  @brief      Sets output statistics to zero
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vReset_Stats()
+{
+    tStats = {0, 0, 0};
+}
+
+
+/******************************************************************************
+ *  @function   sGet_Screen
+ *
+ *  @brief      Returns characters of the virtual screen (frame as shown
+ *              on console), one line per row without trailing blanks.
+ *              Blank cells with other than default color (tokens) show
+ *              their background color as hex digit.
+ *              Used as golden screen for regression checks.
+ *  @param      -
+ *  @return     Screen content (console code page)
+ ******************************************************************************/
+
+std::string ConsoleControl::sGet_Screen()
+{
+    std::string screen, line;
+
+    for (short y = 0; y < oFrame.siGet_Height(); y++)
+    {
+        line.clear();
+
+        for (short x = 0; x < oFrame.siGet_Width(); x++)
+        {
+            FrameBuffer::CELL cell = oFrame.tGet_Shown (x, y);
+
+            if      (cell.chr == CELL_UNKNOWN)      line += CELL_BLANK;
+            else if (cell.chr == CELL_BLANK && cell.color != siColor_Default)
+                                                    line += "0123456789ABCDEF"[cell.color >> 4];
+            else                                    line += cell.chr;
+        }
+        line.erase (line.find_last_not_of (CELL_BLANK) + 1);
+        screen += line + "\n";
+    }
+    screen.erase (screen.find_last_not_of ('\n') + 1);     // No empty rows at end
+
+    return screen + "\n";
+}
+
+
+/******************************************************************************
+ *  @function   iRead_Key
+ *
+ *  @brief      Returns next key event.
+ *              If no key is queued, the frame is shown and the thread
+ *              sleeps until input arrives.
+ *  @param      -
+ *  @return     Key code (control keys with KEY_CTRL_OFFSET)
+ ******************************************************************************/
+
+int ConsoleControl::iRead_Key()
+{
+    if (siKeyCount == 0) vFlush();
+
+    while (siKeyCount == 0) vRead_Input (-1);
+
+    int key     = aKeyQueue[siKeyHead].key;
+    ullKey_Time = aKeyQueue[siKeyHead].time;
+
+    siKeyHead = (siKeyHead + 1) % KEY_QUEUE_SIZE;
+    siKeyCount--;
+
+    return key;
+}
+
+
+/******************************************************************************
+ *  @function   bKey_Ready
+ *
+ *  @brief      Checks for a queued key event, waits for input if none
+ *
+ *  @param      timeout_ms : Maximum wait time, 0 only polls
+ *  @return     bool       : true  if iRead_Key() returns without waiting
+ ******************************************************************************/
+
+bool ConsoleControl::bKey_Ready (short timeout_ms)
+{
+    if (siKeyCount == 0) vRead_Input (timeout_ms);
+
+    return siKeyCount > 0;
+}
+
+
+/******************************************************************************
+ *  @function   vPush_Key
+ *
+ *  @brief      Appends a decoded key event to the queue.
+ *              Keys are dropped if the queue is full (key repeat flood).
+ *              The event keeps the time it was queued.
+ *  @param      key : Key code
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vPush_Key (int key)
+{
+    if (siKeyCount == KEY_QUEUE_SIZE) return;
+
+    aKeyQueue[(siKeyHead + siKeyCount) % KEY_QUEUE_SIZE] = {key, Latency::ullGet_Time()};
+    siKeyCount++;
+}
+
+
+/******************************************************************************
+ *  @function   overflow
+ *
+ *  @brief      Stream interface: writes a character into frame
+ *  @param      chr : Character
+ *  @return     chr
+ ******************************************************************************/
+
+ConsoleControl::ScreenBuffer::int_type ConsoleControl::ScreenBuffer::overflow (int_type chr)
+{
+    if (chr != traits_type::eof())  vPut_Char (chr);
+
+    return chr;
+}
+
+
+/******************************************************************************
+ *  @function   xsputn
+ *
+ *  @brief      Stream interface: writes a character sequence into frame.
+ *              std::endl does not flush anything to console,
+ *              frames are emitted by vFlush() only.
+ *  @param      str : Characters
+ *              len : Number of characters
+ *  @return     len
+ ******************************************************************************/
+
+std::streamsize ConsoleControl::ScreenBuffer::xsputn (const char* str, std::streamsize len)
+{
+    for (std::streamsize i = 0; i < len; i++)  vPut_Char (str[i]);
 
-    WriteConsoleW(GetStdHandle(STD_OUTPUT_HANDLE), wstr, wcslen(wstr), NULL, NULL);
+    return len;
 }
@@ -25,7 +25,17 @@
 
 /*------  System interface includes  -------*/
 #include <iostream>
-#include <wincon.h>      // Console color and cursor control
+#include <streambuf>
+#include <string>
+
+#ifdef _WIN32
+    #include <wincon.h>     // Console color and cursor control
+#else
+    typedef struct {short X; short Y;} COORD;
+#endif
+
+/*------  Module header includes  -------*/
+#include "FrameBuffer.hpp"
 
 /*=============================================================================
 =====                           MACROS / INLINES                          =====
@@ -38,6 +48,9 @@
 #define COL_RED           192
 #define COL_YELLOW        224
 
+/***  Key event queue  ***/
+#define KEY_QUEUE_SIZE    32        // Further keys are dropped until read
+
 /*=============================================================================
 =====                               CLASSES                               =====
 =============================================================================*/
@@ -45,29 +58,90 @@
 class ConsoleControl
 {
     public:
+    /** Types / Structs **/
+        typedef struct {long frames; long calls; long bytes;} OUTPUT_STATS;
+        typedef struct {int key; unsigned long long time;} KEY_EVENT;   // Time queued [ns]
+
     /** Constructor / Destructor **/
                  ConsoleControl();
         virtual ~ConsoleControl();
 
                 virtual void    vCursor_Move    (short x, short y);
+                virtual void    vPrint          (const std::string str);
+                virtual void    vFlush          ();     // Show changed cells
+
+                virtual int     iRead_Key       ();     // Next key, waits for it
+                virtual bool    bKey_Ready      (short timeout_ms);
+                virtual void    vFlush_Input    ();
+
+        static  void    vSet_Turbo      (bool _bTurbo);     // No delays
+        static  bool    bGet_Turbo      ();
+
+        static  unsigned long long  ullGet_KeyTime  ();     // Last key read, queued at
+
+        static  void            vSet_Mock       (bool _bMock);  // Virtual screen only
+        static  OUTPUT_STATS    tGet_Stats      ();             // Console output cost
+        static  void            vReset_Stats    ();
+        static  std::string     sGet_Screen     ();             // Shown frame as text
 
+    /** Nested class **/
+        class ScreenBuffer : public std::streambuf
+        {
+            protected:
+            /** Member functions / methods **/
+                virtual int_type        overflow (int_type chr);
+                virtual std::streamsize xsputn   (const char* str, std::streamsize len);
+        };
 
     protected:
+    /** Objects **/
+        static std::ostream oScreen;    // Output into frame at cursor position
+
     /** Member functions / methods **/
         virtual COORD   tCurPos_Get     ();
         virtual void    vCurPos_Set     (COORD pos);
 
         virtual void    vCursor_Visible (bool  visible);
 
+        virtual short   siColor_Get     ();
         virtual void    vColor_Set      (short color);
         virtual void    vColor_Save     ();
         virtual void    vColor_Restore  ();
 
         virtual void    vPrintU         (const std::wstring str);   // Print unicode
+        virtual void    vPut_Block      (const FrameBuffer::CELL* cells,
+                                         short width, short height);
+        virtual void    vClear_Screen   ();
+
+        virtual void    vOpen_Console   ();
+        virtual void    vWait           (short ms);     // Show frame and wait,
+                                                        // key press ends wait
 
     private:
     /** Variables **/
         short console_color;
+
+        static short        siColor_Default;    // Console color at program start
+        static short        siColor;            // Color of next output
+        static COORD        tCurPos;            // Cursor position within frame
+        static COORD        tCurPos_Shown;      // Cursor position on console
+        static bool         bTurbo;             // Headless / scripted run
+        static bool         bMock;              // No console, virtual screen only
+        static OUTPUT_STATS tStats;             // Frames, console calls, bytes
+
+        static KEY_EVENT    aKeyQueue[KEY_QUEUE_SIZE];  // Decoded key events
+        static short        siKeyHead, siKeyCount;
+        static unsigned long long ullKey_Time;          // Of last key read
+
+    /** Objects **/
+        static FrameBuffer  oFrame;             // Off-screen console content
+        static ScreenBuffer oScreenBuf;
+
+    /** Member functions / methods **/
+        static short    siQuery_Color   ();
+        static void     vPut_Char       (unsigned char chr);
+        static void     vPush_Key       (int key);
+        static void     vRead_Input     (short timeout_ms);     // Decode input
 };
 
 #endif // _CONSOLECONTROL_H_
@@ -0,0 +1,406 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    ConsoleControl_Ansi.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Console interface - ANSI terminal backend (Linux / POSIX)
+ *           Emits frames as ANSI escape sequences with one write() per
+ *           frame and decodes key events from a raw (termios) terminal.
+ *
+ ******************************************************************************/
+
+#ifndef _WIN32
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <cstdlib>          // atexit, exit
+#include <string>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "ConsoleControl.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Maximum gap between ESC and rest of a key escape sequence  ***/
+#define ESC_SEQ_TIMEOUT_MS  25
+
+/***  Bytes read at once  ***/
+#define INPUT_CHUNK         64
+
+/***  Key codes  ***/
+#define CHR_ESC             27
+#define CHR_DEL             127
+
+/*=============================================================================
+=====                          STATIC VARIABLES                           =====
+=============================================================================*/
+
+static struct termios   tTerm_Saved;            // Terminal settings at start
+static bool             bTerm_Raw    = false;   // Raw mode active
+static int              iTerm_Color  = -1;      // Color set on terminal
+static int              iSeq_State   = 0;       // Escape sequence decoding:
+                                                // 0 none, 1 ESC, 2 ESC [
+static std::string      sOut;                   // Output of one frame
+
+/*=============================================================================
+=====                           LOCAL FUNCTIONS                           =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   vWrite_All
+ *
+ *  @brief      Writes a string to the terminal, retries on partial writes
+ *  @param      str : Bytes to write
+ *  @return     -
+ ******************************************************************************/
+
+static void vWrite_All (const std::string& str)
+{
+    size_t done = 0;
+
+    while (done < str.size())
+    {
+        ssize_t len = write (STDOUT_FILENO, str.data() + done, str.size() - done);
+
+        if (len <= 0) return;
+        done += len;
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vClose_Terminal
+ *
+ *  @brief      Restores terminal settings at program exit
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+static void vClose_Terminal()
+{
+    vWrite_All ("\x1b[0m\x1b[?25h\x1b[?1049l");     // Default color, show cursor,
+                                                    // leave alternate screen
+    if (bTerm_Raw) tcsetattr (STDIN_FILENO, TCSAFLUSH, &tTerm_Saved);
+    bTerm_Raw = false;
+}
+
+
+/******************************************************************************
+ *  @function   bWait_Input
+ *
+ *  @brief      Sleeps until terminal input is readable
+ *
+ *  @param      timeout_ms : Maximum wait time, -1 waits forever
+ *  @return     bool       : true  if input is readable
+ ******************************************************************************/
+
+static bool bWait_Input (int timeout_ms)
+{
+    struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+
+    return poll (&pfd, 1, timeout_ms) > 0;
+}
+
+
+/******************************************************************************
+ *  @function   vAppend_Color
+ *
+ *  @brief      Appends SGR sequence for a Windows console color code
+ *              (low nibble foreground, high nibble background;
+ *              bit order blue, green, red, intensity)
+ *
+ *  @param      str   : Output string
+ *              color : Console color code
+ *  @return     -
+ ******************************************************************************/
+
+static void vAppend_Color (std::string& str, unsigned char color)
+{
+    static const char ansi[8] = {0, 4, 2, 6, 1, 5, 3, 7};    // BGR -> RGB order
+
+    short fg = color & 0x0F;
+    short bg = color >> 4;
+
+    str += "\x1b[0;" + std::to_string ((fg & 8 ? 90  : 30) + ansi[fg & 7]) +
+               ";"   + std::to_string ((bg & 8 ? 100 : 40) + ansi[bg & 7]) + "m";
+}
+
+
+/******************************************************************************
+ *  @function   vAppend_Char
+ *
+ *  @brief      Appends a console code page 437 character as UTF-8
+ *
+ *  @param      str : Output string
+ *              chr : Character (code page 437)
+ *  @return     -
+ ******************************************************************************/
+
+static void vAppend_Char (std::string& str, unsigned char chr)
+{
+    switch (chr)
+    {
+        case 179 :  str += "│";  break;    // Line vertical
+        case 180 :  str += "┤";  break;    // Tee left
+        case 186 :  str += "║";  break;    // Double line vertical
+        case 187 :  str += "╗";  break;    // Double corner top right
+        case 188 :  str += "╝";  break;    // Double corner bottom right
+        case 191 :  str += "┐";  break;    // Corner top right
+        case 192 :  str += "└";  break;    // Corner bottom left
+        case 193 :  str += "┴";  break;    // Tee up
+        case 194 :  str += "┬";  break;    // Tee down
+        case 195 :  str += "├";  break;    // Tee right
+        case 196 :  str += "─";  break;    // Line horizontal
+        case 197 :  str += "┼";  break;    // Cross
+        case 200 :  str += "╚";  break;    // Double corner bottom left
+        case 201 :  str += "╔";  break;    // Double corner top left
+        case 205 :  str += "═";  break;    // Double line horizontal
+        case 217 :  str += "┘";  break;    // Corner bottom right
+        case 218 :  str += "┌";  break;    // Corner top left
+        default  :  str += (chr < 128) ? (char)chr : '?';
+    }
+}
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   vOpen_Console
+ *
+ *  @brief      * Switches terminal to raw mode (no line buffer, no echo)
+ *              * Switches to alternate screen and clears it
+ *              Terminal settings are restored at program exit.
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vOpen_Console()
+{
+    if (!bMock && !bTerm_Raw && isatty (STDIN_FILENO))
+    {
+        struct termios tTerm_Raw;
+
+        tcgetattr (STDIN_FILENO, &tTerm_Saved);
+        tTerm_Raw = tTerm_Saved;
+
+        tTerm_Raw.c_lflag    &= ~(ICANON | ECHO);
+        tTerm_Raw.c_iflag    &= ~(ICRNL  | IXON);
+        tTerm_Raw.c_cc[VMIN]  = 1;
+        tTerm_Raw.c_cc[VTIME] = 0;
+
+        tcsetattr (STDIN_FILENO, TCSAFLUSH, &tTerm_Raw);
+        bTerm_Raw = true;
+
+        atexit (vClose_Terminal);
+    }
+
+    sOut += "\x1b[?1049h\x1b[0m\x1b[2J";    // Alternate screen, cleared
+    iTerm_Color   = -1;
+    tCurPos_Shown = {-1, -1};
+
+    oFrame.vInvalidate();
+}
+
+
+/******************************************************************************
+ *  @function   vFlush
+ *
+ *  @brief      Shows frame on terminal.
+ *              Only cells changed since last call are written. Cursor and
+ *              color changes of the frame are collected and written with
+ *              one write() call.
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vFlush()
+{
+    TRACE_SPAN ("render", "frame");
+    Latency::Timer oRender (Latency::RENDER);
+
+    FrameBuffer::REGION band;
+    bool                dirty = false;
+
+    for (short from = 0; oFrame.bGet_Band (from, band); from = band.bottom + 1)
+    {
+        for (short y = band.top; y <= band.bottom; y++)
+        {
+            short next_x = -1;      // Terminal cursor column after last cell
+
+            for (short x = band.left; x <= band.right; x++)
+            {
+                if (!oFrame.bIs_Changed (x, y)) continue;
+
+                FrameBuffer::CELL cell = oFrame.tGet_Cell (x, y);
+
+                // Move terminal cursor only if cell does not follow last cell
+                if (x != next_x)
+                    sOut += "\x1b[" + std::to_string (y + 1) + ";" + std::to_string (x + 1) + "H";
+
+                if (cell.color != iTerm_Color)
+                {
+                    if   (cell.color == siColor_Default) sOut += "\x1b[0m";
+                    else vAppend_Color (sOut, cell.color);
+
+                    iTerm_Color = cell.color;
+                }
+                vAppend_Char (sOut, cell.chr);
+                next_x = x + 1;
+            }
+        }
+        dirty = true;
+    }
+
+    if (dirty)
+    {
+        oFrame.vCommit();
+        tStats.frames++;
+
+        tCurPos_Shown = {-1, -1};   // Terminal cursor was moved by output
+    }
+
+    // Terminal cursor is needed for visible input cursor only
+    if (tCurPos.X != tCurPos_Shown.X || tCurPos.Y != tCurPos_Shown.Y)
+    {
+        sOut += "\x1b[" + std::to_string (tCurPos.Y + 1) + ";" + std::to_string (tCurPos.X + 1) + "H";
+        tCurPos_Shown = tCurPos;
+    }
+
+    if (!sOut.empty())
+    {
+        tStats.calls++;  tStats.bytes += sOut.size();
+
+        if (!bMock) vWrite_All (sOut);
+        sOut.clear();
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vCursor_Visible
+ *
+ *  @brief      Hides cursor or makes him visible.
+ *              Takes effect with next frame output.
+ *
+ *  @param      visible : true   makes cursor visible
+ *                        false  hides cursor
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vCursor_Visible (bool visible)
+{
+    sOut += visible ? "\x1b[?25h" : "\x1b[?25l";
+}
+
+
+/******************************************************************************
+ *  @function   vRead_Input
+ *
+ *  @brief      Reads all available terminal input and queues key events
+ *              * Arrow keys (ESC [ A...D, ESC O A...D) become KEY_UP etc.
+ *              * Enter becomes '\r', backspace becomes 8
+ *              * Other escape sequences are dropped
+ *              Sequences split between reads are continued with the next
+ *              call. Program exits if terminal input is closed.
+ *
+ *  @param      timeout_ms : Maximum wait time for input, -1 waits forever
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vRead_Input (short timeout_ms)
+{
+    unsigned char buf[INPUT_CHUNK];
+
+    if (!bWait_Input (timeout_ms)) return;
+
+    ssize_t len = read (STDIN_FILENO, buf, sizeof(buf));
+
+    if (len <= 0) exit(0);
+
+    for (ssize_t i = 0; i < len; i++)
+    {
+        unsigned char chr = buf[i];
+
+        if (iSeq_State == 1)                    // After ESC
+        {
+            iSeq_State = 0;
+            if (chr == '[' || chr == 'O') {iSeq_State = 2;  continue;}
+            vPush_Key (CHR_ESC);                // Single ESC key
+        }
+        else if (iSeq_State == 2)               // After ESC [
+        {
+            if (chr < 0x40) continue;           // Parameter bytes
+            iSeq_State = 0;
+
+            switch (chr)
+            {
+                case 'A' :  vPush_Key (KEY_UP);     break;
+                case 'B' :  vPush_Key (KEY_DOWN);   break;
+                case 'C' :  vPush_Key (KEY_RIGHT);  break;
+                case 'D' :  vPush_Key (KEY_LEFT);   break;
+            }
+            continue;
+        }
+
+        switch (chr)
+        {
+            case CHR_ESC :  iSeq_State = 1;    break;
+            case CHR_DEL :  vPush_Key (8);     break;
+            case '\n'    :  vPush_Key ('\r');  break;
+            default      :  vPush_Key (chr);
+        }
+    }
+
+    // ESC without following bytes is the ESC key itself
+    if (iSeq_State == 1 && !bWait_Input (ESC_SEQ_TIMEOUT_MS))
+    {
+        iSeq_State = 0;  vPush_Key (CHR_ESC);
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vFlush_Input
+ *
+ *  @brief      Discards pending key presses
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vFlush_Input()
+{
+    tcflush (STDIN_FILENO, TCIFLUSH);
+
+    siKeyCount = 0;  iSeq_State = 0;
+}
+
+
+/******************************************************************************
+ *  @function   siQuery_Color
+ *
+ *  @brief      Returns color code used for terminal default colors
+ *  @param      -
+ *  @return     Console color code (grey on black)
+ ******************************************************************************/
+
+short ConsoleControl::siQuery_Color()
+{
+    return 7;
+}
+
+#endif // _WIN32
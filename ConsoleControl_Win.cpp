@@ -0,0 +1,206 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    ConsoleControl_Win.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Console interface - Windows console backend
+ *           Emits frames through the Win32 console API
+ *           and reads keys through conio.
+ *
+ ******************************************************************************/
+
+#ifdef _WIN32
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <conio.h>          // getch(), _kbhit()
+#include <vector>
+#include <windows.h>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "ConsoleControl.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   vOpen_Console
+ *
+ *  @brief      Clears console, frame is drawn from top left corner
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vOpen_Console()
+{
+    if (!bMock) system("CLS");
+
+    oFrame.vInvalidate();
+}
+
+
+/******************************************************************************
+ *  @function   vFlush
+ *
+ *  @brief      Shows frame on console.
+ *              Only the bands of rows changed since last call are
+ *              written, with one console call per band.
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vFlush()
+{
+    TRACE_SPAN ("render", "frame");
+    Latency::Timer oRender (Latency::RENDER);
+
+    static std::vector<CHAR_INFO> vecOut;   // Reused between frames
+
+    FrameBuffer::REGION band;
+    HANDLE hConsole = GetStdHandle (STD_OUTPUT_HANDLE);
+    bool   dirty    = false;
+
+    for (short from = 0; oFrame.bGet_Band (from, band); from = band.bottom + 1)
+    {
+        COORD      size = {(short)(band.right  - band.left + 1),
+                           (short)(band.bottom - band.top  + 1)};
+        SMALL_RECT rect = {band.left, band.top, band.right, band.bottom};
+
+        vecOut.resize (size.X * size.Y);
+
+        // Copy dirty band of frame into console character buffer
+        for (short y = 0; y < size.Y; y++)
+        {
+            for (short x = 0; x < size.X; x++)
+            {
+                FrameBuffer::CELL cell = oFrame.tGet_Cell (band.left + x, band.top + y);
+
+                vecOut[y * size.X + x].Char.AsciiChar = cell.chr;
+                vecOut[y * size.X + x].Attributes     = cell.color;
+            }
+        }
+        if (!bMock) WriteConsoleOutputA (hConsole, vecOut.data(), size, COORD {0, 0}, &rect);
+
+        tStats.calls++;  tStats.bytes += vecOut.size() * sizeof(CHAR_INFO);
+        dirty = true;
+    }
+
+    if (dirty)
+    {
+        oFrame.vCommit();
+        tStats.frames++;
+    }
+
+    // Console cursor is needed for visible input cursor only
+    if (tCurPos.X != tCurPos_Shown.X || tCurPos.Y != tCurPos_Shown.Y)
+    {
+        if (!bMock) SetConsoleCursorPosition (hConsole, tCurPos);
+        tCurPos_Shown = tCurPos;
+        tStats.calls++;
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vCursor_Visible
+ *
+ *  @brief      Hides cursor or makes him visible
+ *
+ *  @param      visible : true   makes cursor visible
+ *                        false  hides cursor
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vCursor_Visible (bool visible)
+{
+   CONSOLE_CURSOR_INFO cci;
+
+   cci.dwSize   = 10;
+   cci.bVisible = visible;  // Set cursor state visible or invisible
+
+   if (!bMock) SetConsoleCursorInfo (GetStdHandle(STD_OUTPUT_HANDLE), &cci);
+   tStats.calls++;
+}
+
+
+/******************************************************************************
+ *  @function   vRead_Input
+ *
+ *  @brief      Reads all available key presses and queues key events.
+ *              Control keys (like arrow keys) are sent by conio as
+ *              KEY_CTRL_SEQ (or 0) followed by the key code; they are
+ *              queued as one event with KEY_CTRL_OFFSET.
+ *
+ *  @param      timeout_ms : Maximum wait time for input, -1 waits forever
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vRead_Input (short timeout_ms)
+{
+    HANDLE hInput = GetStdHandle (STD_INPUT_HANDLE);
+    DWORD  wait   = (timeout_ms < 0) ? INFINITE : timeout_ms;
+
+    // Input handle is signaled by any console event, discard events
+    // which are no key presses (key release, mouse, focus)
+    while (!_kbhit())
+    {
+        INPUT_RECORD record;
+        DWORD        count;
+
+        if (WaitForSingleObject (hInput, wait) != WAIT_OBJECT_0) return;
+        if (!_kbhit()) ReadConsoleInputA (hInput, &record, 1, &count);
+    }
+
+    while (_kbhit())
+    {
+        int key = getch();
+
+        if (key == KEY_CTRL_SEQ || key == 0) key = getch() + KEY_CTRL_OFFSET;
+        vPush_Key (key);
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vFlush_Input
+ *
+ *  @brief      Discards pending key presses
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ConsoleControl::vFlush_Input()
+{
+    FlushConsoleInputBuffer (GetStdHandle(STD_INPUT_HANDLE));
+
+    siKeyCount = 0;
+}
+
+
+/******************************************************************************
+ *  @function   siQuery_Color
+ *
+ *  @brief      Reads color of console
+ *  @param      -
+ *  @return     Console color code
+ ******************************************************************************/
+
+short ConsoleControl::siQuery_Color()
+{
+    CONSOLE_SCREEN_BUFFER_INFO color;
+    GetConsoleScreenBufferInfo (GetStdHandle(STD_OUTPUT_HANDLE), &color);
+
+    return color.wAttributes;
+}
+
+#endif // _WIN32
@@ -29,7 +29,7 @@
  *  @function   Constructor of class Dialog
  *
  *  @brief      * Instantiates a Dialog object
- *              * Inits start parameter
+ *              * Hides cursor
  *  @param      -
  ******************************************************************************/
 
@@ -37,11 +37,7 @@ Dialog::Dialog()
 {
     DEBUG_CONSTRUCTOR;
 
-    siStartPlayer = 0;
-
-    // Set initial values for Player objects
-    vSet_StartPlayer (oPlayer_H, true);     // First player
-    vSet_StartPlayer (oPlayer_M, false);
+    vOpen_Console();    // Start on empty console, frame is drawn from top
 
     vCursor_Visible (false);
 }
@@ -59,31 +55,30 @@ Dialog::~Dialog()
 
 
 /******************************************************************************
- *  @function   vMenuLoop
+ *  @function   bMenuLoop
  *
  *  @brief      Reads user key press within main menu and jumps to
  *              corresponding functions.
- *              Runs in a loop until a valid key press is recognized.
+ *              Runs in a loop until game start or quit is selected.
  *  @param      -
- *  @return     -
+ *  @return     bool : true   if a game has to be started
+ *                     false  if the program has to be quit
  ******************************************************************************/
 
-void Dialog::vMenuLoop()
+bool Dialog::bMenuLoop()
 {
     short key;
-    bool  run_game = false;
 
-    while (!run_game)
+    while (true)
     {
         // Read key presses
         key = oKey.iReadKeys( {KEY_1, KEY_2, KEY_3, KEY_4, KEY_5, KEY_q, KEY_q} );
 
         switch (key)
         {
-            case KEY_1:  run_game = true;       break;
+            case KEY_1:  return true;
 
-            case KEY_2:  vToggle_CurrentPlayer();
-                         siStartPlayer = siGet_CurrentPlayer();
+            case KEY_2:  vToggle_StartPlayer();
                          vShow_GameCfg();       break;
 
             case KEY_3:  vMenu_BoardSize();     break;
@@ -91,7 +86,7 @@ void Dialog::vMenuLoop()
             case KEY_5:  vRestore_Defaults();   break;
 
             case KEY_q:
-            case KEY_Q:  _Exit(0);
+            case KEY_Q:  return false;
 
             default:     _Exit(1);
         }
@@ -131,21 +126,21 @@ void Dialog::vShow_GameCfg ()
 
     vCurPos_Set (Pos_GameInfo);
 
-    std::cout << "  -------------------------------------------"  << std::endl;
+    oScreen << "  -------------------------------------------"  << std::endl;
     vClear_Below (3, 45);
-    std::cout << "  "; vColor_Set(COL_YELLOW); std::cout << "  "; vColor_Restore();
-    std::cout << " Payer 1 (Human)      ";
-    if (oPlayer_H.bIs_CurrentPlayer()) std::cout <<  "-> FIRST PLAYER";
-    std::cout << std::endl;
+    oScreen << "  "; vColor_Set(COL_YELLOW); oScreen << "  "; vColor_Restore();
+    oScreen << " Payer 1 (Human)      ";
+    if (siGet_StartPlayer() == PLAYER_1_ID) oScreen <<  "-> FIRST PLAYER";
+    oScreen << std::endl;
 
-    std::cout << "  "; vColor_Set(COL_RED); std::cout << "  " ; vColor_Restore();
-    std::cout << " Payer 2 (Computer)   ";
-    if (oPlayer_M.bIs_CurrentPlayer()) std::cout <<  "-> FIRST PLAYER";
-    std::cout << std::endl;
+    oScreen << "  "; vColor_Set(COL_RED); oScreen << "  " ; vColor_Restore();
+    oScreen << " Payer 2 (Computer)   ";
+    if (siGet_StartPlayer() == PLAYER_2_ID) oScreen <<  "-> FIRST PLAYER";
+    oScreen << std::endl;
 
-    std::cout << "     " << siGet_WinTokens() << " Tokens to win" << std::endl;;
+    oScreen << "     " << oGameState.siGet_WinTokens() << " Tokens to win" << std::endl;;
 
-    std::cout << "  -------------------------------------------\n"  << std::endl;
+    oScreen << "  -------------------------------------------\n"  << std::endl;
 }
 
 
@@ -161,7 +156,7 @@ void Dialog::vMenu_Main()
 {
     vCurPos_Set (Pos_Menu);  vClear_Below(5, 40);
 
-    std::cout <<
+    oScreen <<
     "  [ 1 ]   Start game                     \n"
     "  [ 2 ]   Toggle start Player            \n"
     "  [ 3 ]   Change board size              \n"
@@ -196,17 +191,17 @@ void Dialog::vMenu_BoardSize()
     do
     {
         cur_pos = tCurPos_Get();    // Save cursor position
-        std::cout << "  Define slots (Min: " << BOARD_SLOTS_MIN
+        oScreen << "  Define slots (Min: " << BOARD_SLOTS_MIN
                   << " / Max: "              << BOARD_SLOTS_MAX << "):  ";
 
-        slots = siGetNum();  std::cout << std::endl;    // Input numeric value
+        slots = siGetNum();  oScreen << std::endl;    // Input numeric value
 
         // Check if input value is in valid range
         if (slots < BOARD_SLOTS_MIN || slots > BOARD_SLOTS_MAX)
         {
             input_err = true;  BEEP_KEY;
 
-            std::cout << "\n  !!! INVALID input... Please retry !!!" << std::endl;
+            oScreen << "\n  !!! INVALID input... Please retry !!!" << std::endl;
             vCurPos_Set (cur_pos); vClear_Line(80);     // Restore cursor position
         }
         else input_err = false;
@@ -219,17 +214,17 @@ void Dialog::vMenu_BoardSize()
     do
     {
         cur_pos = tCurPos_Get();    // Save cursor position
-        std::cout << "  Define lines (Min: " << BOARD_LINES_MIN
+        oScreen << "  Define lines (Min: " << BOARD_LINES_MIN
                   << " / Max: "              << BOARD_LINES_MAX << "):  ";
 
-        lines = siGetNum();  std::cout << std::endl;    // Input numeric value
+        lines = siGetNum();  oScreen << std::endl;    // Input numeric value
 
         // Check if input value is in valid range
         if (lines < BOARD_LINES_MIN || lines > BOARD_LINES_MAX)
         {
             input_err = true;  BEEP_KEY;
 
-            std::cout << "\n  !!! INVALID input... Please retry !!!" << std::endl;
+            oScreen << "\n  !!! INVALID input... Please retry !!!" << std::endl;
             vCurPos_Set (cur_pos); vClear_Line(80);     // Restore cursor position
         }
         else input_err = false;
@@ -238,7 +233,7 @@ void Dialog::vMenu_BoardSize()
 
     vCursor_Visible (false);            // Hide cursor
 
-    vSet_BoardSize ({slots, lines});    // Sets game board size / dimension
+    oGameState.vSet_BoardSize ({slots, lines});     // Sets game board size
     vUpdate_Screen();                   // Redraw complete screen
 }
 
@@ -267,16 +262,16 @@ void Dialog::vMenu_WinTokens()
     do
     {
         cur_pos = tCurPos_Get();    // Save cursor position
-        std::cout << "  Define number of tokens to win (Min: "
-                  << WIN_TOKENS_MIN << " / Max: " << siGet_WinTokens_Max() << "):  ";
+        oScreen << "  Define number of tokens to win (Min: "
+                  << WIN_TOKENS_MIN << " / Max: " << oGameState.siGet_WinTokens_Max() << "):  ";
 
-        tokens = siGetNum();  std::cout << std::endl;    // Input numeric value
+        tokens = siGetNum();  oScreen << std::endl;    // Input numeric value
 
-        if (tokens < WIN_TOKENS_MIN || tokens > siGet_WinTokens_Max())
+        if (tokens < WIN_TOKENS_MIN || tokens > oGameState.siGet_WinTokens_Max())
         {
             input_err = true;  BEEP_KEY;
 
-            std::cout << "\n  !!! INVALID input... Please retry !!!" << std::endl;
+            oScreen << "\n  !!! INVALID input... Please retry !!!" << std::endl;
             vCurPos_Set (cur_pos); vClear_Line(80);
         }
         else input_err = false;
@@ -285,7 +280,7 @@ void Dialog::vMenu_WinTokens()
 
     vCursor_Visible (false);    // Hide cursor
 
-    vSet_WinTokens (tokens);    // Set new number of tokens to win
+    oGameState.vSet_WinTokens (tokens);     // Set new number of tokens to win
     vUpdate_Screen();           // Redraw complete screen
 }
 
@@ -300,11 +295,9 @@ void Dialog::vMenu_WinTokens()
 
 void Dialog::vRestore_Defaults()
 {
-    vSet_BoardSize ({BOARD_SLOTS, BOARD_LINES});
-    vSet_WinTokens (WIN_TOKENS);
-
-    vSet_StartPlayer (oPlayer_H, true);
-    vSet_StartPlayer (oPlayer_M, false);
+    oGameState.vSet_WinTokens   (WIN_TOKENS);
+    oGameState.vSet_BoardSize   ({BOARD_SLOTS, BOARD_LINES});
+    oGameState.vSet_StartPlayer (PLAYER_1_ID);
 
     vUpdate_Screen();
 }
@@ -341,8 +334,8 @@ void Dialog::vClear_Lines (int lines, int columns)
 {
     for (int y=1; y <= lines; y++)
     {
-        for (int x=1; x <= columns; x++)  std::cout << " ";
-        std::cout << std::endl;
+        for (int x=1; x <= columns; x++)  oScreen << " ";
+        oScreen << std::endl;
     }
 }
 
@@ -380,7 +373,7 @@ void Dialog::vClear_Below (int lines, int columns)
 
 void Dialog::vUpdate_Screen()
 {
-    system("CLS");
+    vClear_Screen();
 
     // Print screen elements and save cursor
     // position of each screen element
@@ -392,34 +385,17 @@ void Dialog::vUpdate_Screen()
 }
 
 
-/******************************************************************************
- *  @function   vSet_StartPlayer
- *
- *  @brief      Sets the first player for the game
- *
- *  @param      obj          : Reference to player object
- *  @param      start_player : ID of first player
- *  @return     -
- ******************************************************************************/
-
-void Dialog::vSet_StartPlayer (Player& obj, bool start_player)
-{
-    obj.bCurrentPlayer = start_player;
-    siStartPlayer = siGet_CurrentPlayer();
-}
-
-
 /******************************************************************************
  *  @function   siGet_StartPlayer
  *
  *  @brief      Returns ID of first player of the game
  *  @param      -
- *  @return     siStartPlayer : ID of first player
+ *  @return     PLAYER_1_ID || PLAYER_2_ID : ID of first player
  ******************************************************************************/
 
 short Dialog::siGet_StartPlayer()
 {
-    return siStartPlayer;
+    return oGameState.siGet_StartPlayer();
 }
 
 
@@ -433,21 +409,20 @@ short Dialog::siGet_StartPlayer()
 
 short Dialog::siGet_CurrentPlayer()
 {
-    return (oPlayer_H.bIs_CurrentPlayer()) ? PLAYER_1_ID : PLAYER_2_ID;
+    return oGameState.siGet_CurrentPlayer();
 }
 
 
 /******************************************************************************
- *  @function   vToggle_CurrentPlayer
+ *  @function   vToggle_StartPlayer
  *
- *  @brief      Switches active player state between booth player
+ *  @brief      Switches first player of the game between booth player
  *  @param      -
  *  @return     -
  ******************************************************************************/
 
-void Dialog::vToggle_CurrentPlayer()
+void Dialog::vToggle_StartPlayer()
 {
-    oPlayer_H.vSet_CurrentPlayer (  oPlayer_M.bIs_CurrentPlayer() );
-    oPlayer_M.vSet_CurrentPlayer ( !oPlayer_M.bIs_CurrentPlayer() );
+    oGameState.vSet_StartPlayer (siGet_StartPlayer() == PLAYER_1_ID ? PLAYER_2_ID
+                                                                    : PLAYER_1_ID);
 }
-
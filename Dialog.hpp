@@ -25,7 +25,9 @@
 
 /*------  System interface includes  -------*/
 #include <iostream>
+#ifdef _WIN32
 #include <windows.h>    // Console color and cursor control
+#endif
 
 /*------  Module header includes  -------*/
 #include "Board.hpp"
@@ -48,20 +50,17 @@ class Dialog : public Board, public Player, public KeyHandler
         COORD   Pos_SlotSelect, Pos_Board, Pos_Menu, Pos_GameInfo;
 
     /** Objects **/
-        Player      oPlayer_H;     // First player
-        Player      oPlayer_M;
         KeyHandler  oKey;
 
     /** Getter / Setter **/
         virtual short   siGet_StartPlayer     ();
         virtual short   siGet_CurrentPlayer   ();
-        virtual void    vSet_StartPlayer      (Player& obj, bool start_player);
-        virtual void    vToggle_CurrentPlayer ();
+        virtual void    vToggle_StartPlayer   ();
 
         virtual void    vMenu_Main        ();
 
     /** Further Member functions / methods **/
-        virtual void    vMenuLoop         ();
+        virtual bool    bMenuLoop         ();
         virtual void    vShow_Title       ();
         virtual void    vShow_GameCfg     ();
 
@@ -69,15 +68,13 @@ class Dialog : public Board, public Player, public KeyHandler
         virtual void    vClear_Lines      (int lines, int columns);
         virtual void    vClear_Below      (int lines, int columns);
 
-    private:
-    /** Variables **/
-        short   siStartPlayer;
+        virtual void    vUpdate_Screen    ();
 
+    private:
     /** Member functions / methods **/
         virtual void    vMenu_BoardSize   ();
         virtual void    vMenu_WinTokens   ();
         virtual void    vRestore_Defaults ();
-        virtual void    vUpdate_Screen    ();
 };
 
 #endif // _DIALOG_H_
@@ -0,0 +1,623 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    DistSolver.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Distributed solver
+ *           Coordinator and worker processes sharing a directory queue
+ *           of work units (positions at a split depth).
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::max
+#include <chrono>       // steady_clock
+#include <condition_variable>
+#include <cstdio>       // std::rename, std::remove
+#include <cstdlib>      // std::system
+#include <ctime>        // time(NULL)
+#include <fstream>
+#include <iomanip>      // std::setprecision
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+    #include <direct.h>     // _mkdir
+    #include <process.h>    // _getpid
+#else
+    #include <unistd.h>     // getpid
+#endif
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "DistSolver.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class DistSolver
+ *
+ *  @brief      Instantiates a DistSolver object
+ *  @param      -
+ ******************************************************************************/
+
+DistSolver::DistSolver()
+{
+    DEBUG_CONSTRUCTOR;
+
+    siLease  = DIST_LEASE_S;
+    siValue  = SOLVE_UNKNOWN;
+    dRunTime = 0;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class DistSolver
+ *
+ *  @brief      Destroys this DistSolver object
+ ******************************************************************************/
+
+DistSolver::~DistSolver()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Program
+ *
+ *  @brief      Sets program started for local worker processes
+ *
+ *  @param      program : Path of program (argv[0])
+ *  @return     -
+ ******************************************************************************/
+
+void DistSolver::vSet_Program (const std::string& program)
+{
+    sProgram = program;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Lease
+ *
+ *  @brief      Sets time after which a claim without heartbeat is requeued
+ *
+ *  @param      seconds : Lease time (at least 2 heartbeats)
+ *  @return     -
+ ******************************************************************************/
+
+void DistSolver::vSet_Lease (short seconds)
+{
+    siLease = std::max (seconds, (short)(2 * DIST_HEARTBEAT_MS / 1000));
+}
+
+
+/******************************************************************************
+ *  @function   siSolve
+ *
+ *  @brief      Coordinator:
+ *              * Splits the game tree at depth into units
+ *              * Queues units without result, starts local workers
+ *              * Waits for all results, requeues stale claims
+ *              * Merges results back up to the root
+ *
+ *  @param      _oGameState : Root position
+ *              dir         : Queue directory (shared by all workers)
+ *              depth       : Split depth in moves
+ *              workers     : Local worker processes to start, zero if
+ *                            workers are started separately
+ *  @return     SOLVE_WIN, SOLVE_DRAW, SOLVE_LOSS for side to move,
+ *              SOLVE_UNKNOWN if queue can not be written
+ ******************************************************************************/
+
+short DistSolver::siSolve (const GameState& _oGameState, const std::string& dir,
+                           short depth, short workers)
+{
+    GameState oRoot = _oGameState;
+    auto      tStart = std::chrono::steady_clock::now();
+
+    mapUnits.clear();
+    mapResults.clear();
+    siValue = SOLVE_UNKNOWN;
+
+    if (!Solver::bSupported (oRoot.tGet_BoardSize().slot, oRoot.tGet_BoardSize().line) ||
+        oRoot.siCheck_WinState() != 0 || oRoot.siGet_FreeSlots() == 0) return SOLVE_UNKNOWN;
+
+    vSplit (oRoot, depth);
+
+    if (!bQueue_Units (dir)) return SOLVE_UNKNOWN;
+
+    vRead_Results (dir);
+    for (auto& result : mapResults)  result.second.worker = "(earlier run)";
+
+    vStart_Workers (dir, workers);
+
+    while (mapResults.size() < mapUnits.size())
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (DIST_POLL_MS));
+
+        vRequeue_Stale (dir);
+        vRead_Results (dir);
+    }
+
+    std::ofstream (dir + "/finished") << "finished\n";
+
+    siValue  = siMerge (oRoot, depth);
+    dRunTime = std::chrono::duration<double> (std::chrono::steady_clock::now() - tStart).count();
+
+    return siValue;
+}
+
+
+/******************************************************************************
+ *  @function   bRun_Worker
+ *
+ *  @brief      Worker: claims pending units by renaming them, solves them
+ *              and writes their results until the coordinator marks the
+ *              queue finished. While a unit is solved, a thread rewrites
+ *              the claim as heartbeat. Built with SEARCH_STATS, search
+ *              statistics of each unit and their total are printed.
+ *
+ *  @param      dir  : Queue directory
+ *  @return     bool : false  if directory is no queue
+ ******************************************************************************/
+
+bool DistSolver::bRun_Worker (const std::string& dir)
+{
+    Solver              oSolver;
+    Solver::SOLVE_STATS tTotal = Solver::SOLVE_STATS();
+    std::string         worker = sWorker_Id();
+
+    if (!bExists (dir + "/pending")) return false;
+
+    while (!bExists (dir + "/finished"))
+    {
+        bool claimed = false;
+
+        for (const std::string& name : vecList (dir + "/pending"))
+        {
+            std::string claim = dir + "/claimed/" + name + "." + worker;
+
+            // Rename is atomic, only one worker gets the unit
+            if (std::rename ((dir + "/pending/" + name).c_str(), claim.c_str()) != 0) continue;
+
+            std::string unit;
+            std::getline (std::ifstream (claim), unit);
+
+            std::istringstream in (unit);
+            short              slots = 0, lines = 0, tokens = 0, start = 0, slot;
+            GameState          oGameState;
+
+            in >> slots >> lines >> tokens >> start;
+            oGameState.vSet_BoardSize   ({slots, lines});
+            oGameState.vSet_WinTokens   (tokens);
+            oGameState.vSet_StartPlayer (start);
+            while (in >> slot)  oGameState.bPlay_Move (slot);
+
+            std::mutex              oMutex;
+            std::condition_variable oDone;
+            bool                    bBusy = true;
+
+            std::thread oHeartbeat ([&]()
+            {
+                std::unique_lock<std::mutex> oLock (oMutex);
+
+                // Renaming keeps the age of the pending unit, so the claim
+                // is refreshed at once and then once per heartbeat
+                do
+                {
+                    // No new file if the claim was requeued meanwhile
+                    std::fstream file (claim, std::ios::in | std::ios::out);
+
+                    if (file) file << unit << "\n";
+                }
+                while (!oDone.wait_for (oLock, std::chrono::milliseconds (DIST_HEARTBEAT_MS),
+                                        [&]() {return !bBusy;}));
+            });
+
+            std::string checkpoint = dir + "/checkpoint/" + name;
+
+            oSolver.vSet_Checkpoint (checkpoint, DIST_CHECKPOINT_S);
+            oSolver.vReset_Stats();
+
+            auto      tStart = std::chrono::steady_clock::now();
+            long long nodes  = oSolver.llGet_Nodes();
+            short     value  = oSolver.siSolve (oGameState);
+
+            std::chrono::duration<double> tTime = std::chrono::steady_clock::now() - tStart;
+
+            {
+                std::lock_guard<std::mutex> oLock (oMutex);
+                bBusy = false;
+            }
+            oDone.notify_one();
+            oHeartbeat.join();
+
+            std::string result = dir + "/done/" + name;
+            std::string temp   = dir + "/" + name + "." + worker;
+
+            std::ofstream (temp) << value << " " << oSolver.llGet_Nodes() - nodes << " "
+                                 << tTime.count() << " " << worker << "\n";
+
+            if (std::rename (temp.c_str(), result.c_str()) != 0) std::remove (temp.c_str());
+            std::remove (claim.c_str());
+            std::remove (checkpoint.c_str());
+
+            STATS (std::cout << name << " " << Solver::sGet_Json (oSolver.tGet_Stats()) << std::endl);
+            Solver::vAdd_Stats (tTotal, oSolver.tGet_Stats());
+
+            claimed = true;
+            break;      // Pending units may have changed
+        }
+
+        if (!claimed) std::this_thread::sleep_for (std::chrono::milliseconds (DIST_POLL_MS));
+    }
+    STATS (std::cout << "total " << Solver::sGet_Json (tTotal) << std::endl);
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   vShow_Results
+ *
+ *  @brief      Prints result, work per worker and parallel efficiency
+ *              (unit solving time of all workers per run time and worker)
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void DistSolver::vShow_Results()
+{
+    static const char* VALUE[4] = {"loss", "draw", "win", "unknown"};
+
+    std::map<std::string, std::pair<long, double>> mapWorkers;
+    long long nodes = 0;
+    double    busy  = 0;
+
+    for (const auto& result : mapResults)
+    {
+        nodes += result.second.nodes;
+        mapWorkers[result.second.worker].first++;
+        mapWorkers[result.second.worker].second += result.second.seconds;
+
+        if (result.second.worker != "(earlier run)") busy += result.second.seconds;
+    }
+
+    short workers = mapWorkers.size() - mapWorkers.count ("(earlier run)");
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "  Value for side to move : " << VALUE[siValue + 1] << "\n"
+              << "  Units                  : " << mapUnits.size() << "\n"
+              << "  Positions searched     : " << nodes << "\n"
+              << "  Run time [s]           : " << dRunTime << "\n";
+
+    for (const auto& worker : mapWorkers)
+        std::cout << "  Worker " << std::setw(16) << std::left << worker.first << std::right
+                  << ": " << worker.second.first << " units, " << worker.second.second << " s\n";
+
+    if (workers > 0 && dRunTime > 0)
+        std::cout << "  Parallel efficiency    : " << 100 * busy / (dRunTime * workers) << " %\n";
+}
+
+
+/******************************************************************************
+ *  @function   vSplit
+ *
+ *  @brief      Collects the positions at depth as units. Branches ending
+ *              earlier need no unit, mirror images share one unit.
+ *
+ *  @param      _oGameState : Position, unchanged on return
+ *              depth       : Remaining moves to split depth
+ *  @return     -
+ ******************************************************************************/
+
+void DistSolver::vSplit (GameState& _oGameState, short depth)
+{
+    if (depth == 0)
+    {
+        std::ostringstream moves;
+        GameState::BOARD   size = _oGameState.tGet_BoardSize();
+
+        moves << size.slot << " " << size.line << " " << _oGameState.siGet_WinTokens() << " "
+              << _oGameState.siGet_StartPlayer();
+        for (short i = 0; i < _oGameState.siGet_MoveCount(); i++)  moves << " " << _oGameState.siGet_Move (i);
+
+        mapUnits.insert (std::make_pair (sUnit_Name (_oGameState), moves.str()));
+        return;
+    }
+
+    for (short slot = 1; slot <= _oGameState.tGet_BoardSize().slot; slot++)
+    {
+        if (!_oGameState.bPlay_Move (slot)) continue;
+
+        if (_oGameState.siCheck_WinState() == 0 && _oGameState.siGet_FreeSlots() > 0)
+            vSplit (_oGameState, depth - 1);
+
+        _oGameState.bUndo_Move();
+    }
+}
+
+
+/******************************************************************************
+ *  @function   siMerge
+ *
+ *  @brief      Computes the value of a position from the unit results
+ *              (negamax over the moves down to the split depth)
+ *
+ *  @param      _oGameState : Position, unchanged on return
+ *              depth       : Remaining moves to split depth
+ *  @return     Value for side to move
+ ******************************************************************************/
+
+short DistSolver::siMerge (GameState& _oGameState, short depth)
+{
+    if (depth == 0) return mapResults[sUnit_Name (_oGameState)].value;
+
+    short best = SOLVE_LOSS;
+
+    for (short slot = 1; slot <= _oGameState.tGet_BoardSize().slot; slot++)
+    {
+        if (!_oGameState.bPlay_Move (slot)) continue;
+
+        short value = (_oGameState.siCheck_WinState() != 0) ? SOLVE_WIN  :
+                      (_oGameState.siGet_FreeSlots() == 0)  ? SOLVE_DRAW :
+                                                              -siMerge (_oGameState, depth - 1);
+        _oGameState.bUndo_Move();
+
+        best = std::max (best, value);
+    }
+    return best;
+}
+
+
+/******************************************************************************
+ *  @function   bQueue_Units
+ *
+ *  @brief      Creates the queue directories and queues all units which
+ *              have no result and are not pending or claimed yet. Units
+ *              are written beside the queue and moved in, so workers
+ *              never read partly written units.
+ *
+ *  @param      dir  : Queue directory
+ *  @return     bool : false  if directories can not be created
+ ******************************************************************************/
+
+bool DistSolver::bQueue_Units (const std::string& dir)
+{
+    for (const char* sub : {"", "/checkpoint", "/pending", "/claimed", "/done"})
+        if (!bMake_Dir (dir + sub)) return false;
+
+    std::remove ((dir + "/finished").c_str());
+
+    std::set<std::string> setQueued;
+
+    for (const std::string& name : vecList (dir + "/pending"))  setQueued.insert (name);
+    for (const std::string& name : vecList (dir + "/done"))     setQueued.insert (name);
+    for (const std::string& name : vecList (dir + "/claimed"))  setQueued.insert (name.substr (0, name.rfind ('.')));
+
+    for (const auto& unit : mapUnits)
+    {
+        if (setQueued.count (unit.first) > 0) continue;
+
+        std::string temp = dir + "/" + unit.first;
+
+        std::ofstream (temp) << unit.second << "\n";
+        if (std::rename (temp.c_str(), (dir + "/pending/" + unit.first).c_str()) != 0) return false;
+    }
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   vRequeue_Stale
+ *
+ *  @brief      Moves claims without heartbeat for the lease time back to
+ *              pending, removes claims of units with result
+ *
+ *  @param      dir : Queue directory
+ *  @return     -
+ ******************************************************************************/
+
+void DistSolver::vRequeue_Stale (const std::string& dir)
+{
+    for (const std::string& name : vecList (dir + "/claimed"))
+    {
+        std::string unit  = name.substr (0, name.rfind ('.'));
+        std::string claim = dir + "/claimed/" + name;
+
+        if (bExists (dir + "/done/" + unit))
+            std::remove (claim.c_str());
+        else if (llAge (claim) > siLease)
+            std::rename (claim.c_str(), (dir + "/pending/" + unit).c_str());
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vRead_Results
+ *
+ *  @brief      Reads results of units not read yet
+ *
+ *  @param      dir : Queue directory
+ *  @return     -
+ ******************************************************************************/
+
+void DistSolver::vRead_Results (const std::string& dir)
+{
+    for (const std::string& name : vecList (dir + "/done"))
+    {
+        if (mapUnits.count (name) == 0 || mapResults.count (name) > 0) continue;
+
+        std::ifstream in (dir + "/done/" + name);
+        RESULT        result;
+
+        if (in >> result.value >> result.nodes >> result.seconds >> result.worker)
+            mapResults[name] = result;
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vStart_Workers
+ *
+ *  @brief      Starts local worker processes in the background
+ *
+ *  @param      dir     : Queue directory
+ *              workers : Number of processes
+ *  @return     -
+ ******************************************************************************/
+
+void DistSolver::vStart_Workers (const std::string& dir, short workers)
+{
+    std::string command = "\"" + sProgram + "\" --solve-worker \"" + dir + "\"";
+
+#ifdef _WIN32
+    command = "start \"\" /B " + command;
+#else
+    command = command + " > /dev/null 2>&1 &";
+#endif
+
+    for (short i = 0; i < workers && !sProgram.empty(); i++)
+        if (std::system (command.c_str()) != 0) std::cerr << "Can not start worker" << std::endl;
+}
+
+
+/******************************************************************************
+ *  @function   sUnit_Name
+ *
+ *  @brief      Returns file name of a unit: rules and key of position
+ *
+ *  @param      _oGameState : Position
+ *  @return     Name, e.g. "7x6x4_000000000204c081"
+ ******************************************************************************/
+
+std::string DistSolver::sUnit_Name (const GameState& _oGameState)
+{
+    std::ostringstream name;
+
+    name << _oGameState.tGet_BoardSize().slot << "x" << _oGameState.tGet_BoardSize().line << "x"
+         << _oGameState.siGet_WinTokens() << "_" << std::hex << std::setw(16) << std::setfill('0')
+         << Solver::ullGet_Key (_oGameState);
+
+    return name.str();
+}
+
+
+/******************************************************************************
+ *  @function   sWorker_Id
+ *
+ *  @brief      Returns name of this worker process
+ *  @param      -
+ *  @return     Process ID and start time
+ ******************************************************************************/
+
+std::string DistSolver::sWorker_Id()
+{
+#ifdef _WIN32
+    long pid = _getpid();
+#else
+    long pid = getpid();
+#endif
+
+    return "w" + std::to_string (pid) + "-" + std::to_string (time (NULL) % 100000);
+}
+
+
+/******************************************************************************
+ *  @function   vecList
+ *
+ *  @brief      Lists the files of a directory (without hidden files)
+ *
+ *  @param      dir : Directory
+ *  @return     File names
+ ******************************************************************************/
+
+std::vector<std::string> DistSolver::vecList (const std::string& dir)
+{
+    std::vector<std::string> vecNames;
+    DIR*                     pDir = opendir (dir.c_str());
+
+    if (pDir == NULL) return vecNames;
+
+    for (struct dirent* pEntry = readdir (pDir); pEntry != NULL; pEntry = readdir (pDir))
+        if (pEntry->d_name[0] != '.') vecNames.push_back (pEntry->d_name);
+
+    closedir (pDir);
+
+    return vecNames;
+}
+
+
+/******************************************************************************
+ *  @function   bExists
+ *
+ *  @brief      Checks if a file or directory exists
+ *
+ *  @param      path : File or directory
+ *  @return     bool : true  if it exists
+ ******************************************************************************/
+
+bool DistSolver::bExists (const std::string& path)
+{
+    struct stat info;
+
+    return stat (path.c_str(), &info) == 0;
+}
+
+
+/******************************************************************************
+ *  @function   bMake_Dir
+ *
+ *  @brief      Creates a directory
+ *
+ *  @param      path : Directory
+ *  @return     bool : true  if directory exists afterwards
+ ******************************************************************************/
+
+bool DistSolver::bMake_Dir (const std::string& path)
+{
+#ifdef _WIN32
+    _mkdir (path.c_str());
+#else
+    mkdir (path.c_str(), 0755);
+#endif
+
+    return bExists (path);
+}
+
+
+/******************************************************************************
+ *  @function   llAge
+ *
+ *  @brief      Returns time since last change of a file
+ *
+ *  @param      path : File
+ *  @return     Seconds, zero if file does not exist
+ ******************************************************************************/
+
+long long DistSolver::llAge (const std::string& path)
+{
+    struct stat info;
+
+    if (stat (path.c_str(), &info) != 0) return 0;
+
+    return (long long)time (NULL) - info.st_mtime;
+}
@@ -0,0 +1,114 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    DistSolver.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   DistSolver
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _DISTSOLVER_H_
+#define _DISTSOLVER_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <map>
+#include <string>
+#include <vector>
+
+/*------  Module header includes  -------*/
+#include "Solver.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Work queue directory layout  ***
+ *
+ *  <dir>/pending/<unit>            Unit waiting for a worker
+ *  <dir>/claimed/<unit>.<worker>   Unit being solved, rewritten as heartbeat
+ *  <dir>/done/<unit>               Result of unit
+ *  <dir>/checkpoint/<unit>         Table of unit being solved, resumed by
+ *                                  the next worker if the claim is lost
+ *  <dir>/finished                  All units done, workers exit
+ *
+ *  Unit names are the hex key of the unit position, files are text:
+ *  unit   : slots lines tokens start_player moves ...
+ *  result : value nodes seconds worker
+ */
+#define DIST_HEARTBEAT_MS   1000
+#define DIST_LEASE_S        10      // Claims without heartbeat are requeued
+#define DIST_POLL_MS        100
+#define DIST_CHECKPOINT_S   60      // Interval of table checkpoints
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Distributed solving over a shared directory. The coordinator splits
+ *  the game tree at a fixed depth into units (positions, mirror images
+ *  merged), workers claim units by renaming them and solve them with
+ *  their own Solver. All state is kept in files, so lost workers are
+ *  replaced by requeuing their claims and a stopped coordinator simply
+ *  runs again; finished units are not solved twice, units of lost
+ *  workers continue from their latest table checkpoint.               */
+
+class DistSolver
+{
+    public:
+    /** Constructor / Destructor **/
+                 DistSolver();
+        virtual ~DistSolver();
+
+    /** Getter / Setter **/
+        void    vSet_Program    (const std::string& program);
+        void    vSet_Lease      (short seconds);
+
+    /** Member functions / methods **/
+        virtual short   siSolve     (const GameState& _oGameState, const std::string& dir,
+                                     short depth, short workers);
+        virtual bool    bRun_Worker (const std::string& dir);
+        virtual void    vShow_Results   ();
+
+    private:
+    /** Types / Structs **/
+        typedef struct {short value; long long nodes; double seconds; std::string worker;} RESULT;
+
+    /** Variables **/
+        std::string     sProgram;           // Started as worker process
+        short           siLease;
+        short           siValue;
+        double          dRunTime;
+
+        std::map<std::string, std::string>  mapUnits;      // Name, moves
+        std::map<std::string, RESULT>       mapResults;
+
+    /** Member functions / methods **/
+        void    vSplit          (GameState& _oGameState, short depth);
+        short   siMerge         (GameState& _oGameState, short depth);
+        bool    bQueue_Units    (const std::string& dir);
+        void    vRequeue_Stale  (const std::string& dir);
+        void    vRead_Results   (const std::string& dir);
+        void    vStart_Workers  (const std::string& dir, short workers);
+
+        static std::string  sUnit_Name  (const GameState& _oGameState);
+        static std::string  sWorker_Id  ();
+        static std::vector<std::string> vecList (const std::string& dir);
+        static bool         bExists     (const std::string& path);
+        static bool         bMake_Dir   (const std::string& path);
+        static long long    llAge       (const std::string& path);
+};
+
+#endif // _DISTSOLVER_H_
@@ -0,0 +1,151 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    EvalBench.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Evaluation benchmark
+ *           Reports time per move of the full win check and of the
+ *           incremental windows, and errors between both.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <chrono>       // steady_clock
+#include <cstdlib>      // std::abs
+#include <iostream>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "EvalBench.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class EvalBench
+ *
+ *  @brief      Instantiates an EvalBench object
+ *  @param      -
+ ******************************************************************************/
+
+EvalBench::EvalBench()
+{
+    DEBUG_CONSTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class EvalBench
+ *
+ *  @brief      Destroys this EvalBench object
+ ******************************************************************************/
+
+EvalBench::~EvalBench()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   vRun
+ *
+ *  @brief      Runs the benchmark for a set of board sizes and win tokens
+ *              and prints one result line each
+ *
+ *  @param      games : Number of games per configuration
+ *  @return     -
+ ******************************************************************************/
+
+void EvalBench::vRun (long games)
+{
+    static const short configs[5][3] = {{7, 6, 4}, {10, 8, 5}, {15, 15, 3}, {15, 15, 5}, {15, 15, 8}};
+
+    for (const auto& config : configs)  vRun_Config (config[0], config[1], config[2], games);
+}
+
+
+/******************************************************************************
+ *  @function   vRun_Config
+ *
+ *  @brief      Plays random games on one configuration, replays them
+ *              through the windows and prints the results
+ *
+ *  @param      slots, lines : Board size
+ *              tokens       : Win tokens
+ *              games        : Number of games
+ *  @return     -
+ ******************************************************************************/
+
+void EvalBench::vRun_Config (short slots, short lines, short tokens, long games)
+{
+    Player::RandomNr                oRandomNr;
+    WindowEval                      oEval;
+    GameState                       oGameState;
+    std::vector<std::vector<short>> vecGames;
+    long                            moves = 0, errors = 0;
+
+    oRandomNr.vSet_Seed (BENCH_SEED);
+    oGameState.vSet_BoardSize  ({slots, lines});
+    oGameState.vSet_WinTokens  (tokens);
+    oEval.vSet_Game (oGameState);
+
+    // Full scan after each move, as the game does
+    auto tStart = std::chrono::steady_clock::now();
+
+    for (long game = 0; game < games; game++)
+    {
+        std::vector<short> vecMoves;
+
+        oGameState.vReset();
+
+        while (oGameState.siGet_FreeSlots() > 0)
+        {
+            short slot = oGameState.siGet_FreeSlotNr (oRandomNr.iRndNum (1, oGameState.siGet_FreeSlots()));
+
+            oGameState.bPlay_Move (slot);
+            vecMoves.push_back (oGameState.siCheck_WinState() != 0 ? -slot : slot);
+
+            if (vecMoves.back() < 0) break;
+        }
+        moves += vecMoves.size();
+        vecGames.push_back (vecMoves);
+    }
+    std::chrono::duration<double> tScan = std::chrono::steady_clock::now() - tStart;
+
+    // Same games through the windows, then taken back
+    tStart = std::chrono::steady_clock::now();
+
+    for (const std::vector<short>& vecMoves : vecGames)
+    {
+        short player = PLAYER_1_ID;
+
+        for (short move : vecMoves)
+        {
+            oEval.bPlay_Move (std::abs (move), player);
+            if ((oEval.siGet_Winner() != 0) != (move < 0)) errors++;
+
+            player = (player == PLAYER_1_ID) ? PLAYER_2_ID : PLAYER_1_ID;
+        }
+        for (auto move = vecMoves.rbegin(); move != vecMoves.rend(); move++)
+            oEval.bUndo_Move (std::abs (*move));
+
+        if (oEval.llGet_Score() != 0 || oEval.siGet_Threats (PLAYER_1_ID) != 0) errors++;
+    }
+    std::chrono::duration<double> tEval = std::chrono::steady_clock::now() - tStart;
+
+    std::cout << "  " << slots << "x" << lines << "x" << tokens << " : "
+              << oEval.liGet_Windows() << " windows, " << moves << " moves, scan "
+              << tScan.count() * 1e9 / moves << " ns, windows "
+              << tEval.count() * 1e9 / moves << " ns per move (with undo), "
+              << errors << " errors" << std::endl;
+}
@@ -0,0 +1,53 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    EvalBench.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   EvalBench
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _EVALBENCH_H_
+#define _EVALBENCH_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <vector>
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Evaluation benchmark. Plays random games with a full win check after
+ *  each move, as the game does, then replays them through the windows
+ *  of WindowEval and takes them back. Winners of both have to match and
+ *  the windows have to be empty again.                                 */
+
+class EvalBench
+{
+    public:
+    /** Constructor / Destructor **/
+                 EvalBench();
+        virtual ~EvalBench();
+
+    /** Member functions / methods **/
+        virtual void    vRun        (long games);
+
+    protected:
+    /** Member functions / methods **/
+        virtual void    vRun_Config (short slots, short lines, short tokens, long games);
+};
+
+#endif // _EVALBENCH_H_
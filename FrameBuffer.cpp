@@ -0,0 +1,354 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    FrameBuffer.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Frame buffer interface
+ *           Provides an off-screen console frame with tracking of the
+ *           region that changed since it was last shown.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::min, std::max
+#include <cstring>      // std::memcmp, std::memcpy
+
+/*------  Module includes  -------*/
+#include "FrameBuffer.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class FrameBuffer
+ *
+ *  @brief      * Instantiates a FrameBuffer object with blank cells
+ *              * Complete frame has to be shown with first emission
+ *  @param      -
+ ******************************************************************************/
+
+FrameBuffer::FrameBuffer()
+{
+    siWidth      = FRAME_WIDTH;
+    siHeight     = 0;
+    ucBlankColor = 7;               // Console default: grey on black
+    bDirty       = false;
+    siDirty_Top  = siDirty_Bottom = 0;
+
+    vGrow (FRAME_HEIGHT);
+    vInvalidate();
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Width
+ *
+ *  @brief      Returns number of columns of the frame
+ *  @param      -
+ *  @return     siWidth : Number of columns
+ ******************************************************************************/
+
+short FrameBuffer::siGet_Width() const
+{
+    return siWidth;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Height
+ *
+ *  @brief      Returns number of lines of the frame
+ *  @param      -
+ *  @return     siHeight : Number of lines
+ ******************************************************************************/
+
+short FrameBuffer::siGet_Height() const
+{
+    return siHeight;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Cell
+ *
+ *  @brief      Returns character and color of a cell in current frame
+ *
+ *  @param      x, y : Cell coordinate
+ *  @return     CELL : Character and color of cell
+ ******************************************************************************/
+
+FrameBuffer::CELL FrameBuffer::tGet_Cell (short x, short y) const
+{
+    return vecCells[y * siWidth + x];
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Shown
+ *
+ *  @brief      Returns character and color of a cell as shown on console
+ *
+ *  @param      x, y : Cell coordinate
+ *  @return     CELL : Character and color of cell (CELL_UNKNOWN if unknown)
+ ******************************************************************************/
+
+FrameBuffer::CELL FrameBuffer::tGet_Shown (short x, short y) const
+{
+    return vecShown[y * siWidth + x];
+}
+
+
+/******************************************************************************
+ *  @function   bIs_Changed
+ *
+ *  @brief      Checks if a cell differs from the cell shown on console
+ *
+ *  @param      x, y : Cell coordinate
+ *  @return     bool : true  if cell has to be emitted
+ ******************************************************************************/
+
+bool FrameBuffer::bIs_Changed (short x, short y) const
+{
+    const CELL& cur   = vecCells[y * siWidth + x];
+    const CELL& shown = vecShown[y * siWidth + x];
+
+    return cur.chr != shown.chr  ||  cur.color != shown.color;
+}
+
+
+/******************************************************************************
+ *  @function   bGet_Band
+ *
+ *  @brief      Returns the next band of rows changed since last emission:
+ *              consecutive rows with changed cells, from the leftmost to
+ *              the rightmost changed cell of these rows
+ *
+ *  @param      from : First row searched
+ *              band : Receives dirty band (inclusive coordinates)
+ *  @return     bool : false  if no row from there on changed
+ ******************************************************************************/
+
+bool FrameBuffer::bGet_Band (short from, REGION& band) const
+{
+    if (!bDirty) return false;
+
+    short y = std::max (from, siDirty_Top);
+
+    while (y <= siDirty_Bottom && vecDirty[y].left > vecDirty[y].right) y++;
+    if    (y >  siDirty_Bottom) return false;
+
+    band = REGION {vecDirty[y].left, y, vecDirty[y].right, y};
+
+    for (y++; y <= siDirty_Bottom && vecDirty[y].left <= vecDirty[y].right; y++)
+    {
+        band.left   = std::min (band.left,  vecDirty[y].left);
+        band.right  = std::max (band.right, vecDirty[y].right);
+        band.bottom = y;
+    }
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Blank
+ *
+ *  @brief      Sets color of blank (cleared) cells
+ *
+ *  @param      color : Console color code
+ *  @return     -
+ ******************************************************************************/
+
+void FrameBuffer::vSet_Blank (unsigned char color)
+{
+    ucBlankColor = color;
+}
+
+
+/******************************************************************************
+ *  @function   vPut
+ *
+ *  @brief      Writes a character into current frame.
+ *              Frame grows if y is below last line, x beyond last column
+ *              is clipped.
+ *
+ *  @param      x, y  : Cell coordinate
+ *              chr   : Character (console code page)
+ *              color : Console color code
+ *  @return     -
+ ******************************************************************************/
+
+void FrameBuffer::vPut (short x, short y, unsigned char chr, unsigned char color)
+{
+    if (x < 0 || y < 0 || x >= siWidth) return;
+
+    if (y >= siHeight) vGrow (y + FRAME_HEIGHT);
+
+    CELL& cell = vecCells[y * siWidth + x];
+
+    if (cell.chr == chr && cell.color == color) return;
+
+    cell.chr = chr;  cell.color = color;
+
+    vMark_Dirty (x, y);
+}
+
+
+/******************************************************************************
+ *  @function   vPut_Cells
+ *
+ *  @brief      Copies a row of prepared cells into current frame.
+ *              Only the range from first to last changed cell is copied
+ *              and becomes dirty. Cells beyond last column are clipped.
+ *
+ *  @param      x, y  : Coordinate of first cell
+ *              cells : Characters and colors
+ *              count : Number of cells
+ *  @return     -
+ ******************************************************************************/
+
+void FrameBuffer::vPut_Cells (short x, short y, const CELL* cells, short count)
+{
+    if (x < 0 || y < 0 || x >= siWidth) return;
+
+    if (y >= siHeight) vGrow (y + FRAME_HEIGHT);
+
+    count = std::min<short> (count, siWidth - x);
+
+    CELL* row   = &vecCells[y * siWidth + x];
+    short first = 0, last = count - 1;
+
+    while (first <= last && std::memcmp (&row[first], &cells[first], sizeof(CELL)) == 0) first++;
+    if    (first >  last) return;
+    while (std::memcmp (&row[last], &cells[last], sizeof(CELL)) == 0) last--;
+
+    std::memcpy (&row[first], &cells[first], (last - first + 1) * sizeof(CELL));
+
+    vMark_Dirty (x + first, y);  vMark_Dirty (x + last, y);
+}
+
+
+/******************************************************************************
+ *  @function   vClear
+ *
+ *  @brief      Sets all cells of current frame blank.
+ *              Only cells that actually change become dirty.
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void FrameBuffer::vClear()
+{
+    for (short y = 0; y < siHeight; y++)
+    {
+        for (short x = 0; x < siWidth; x++)  vPut (x, y, CELL_BLANK, ucBlankColor);
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vCommit
+ *
+ *  @brief      Marks dirty cells as shown on console
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void FrameBuffer::vCommit()
+{
+    if (!bDirty) return;
+
+    for (short y = siDirty_Top; y <= siDirty_Bottom; y++)
+    {
+        SPAN& span = vecDirty[y];
+
+        if (span.left > span.right) continue;
+
+        std::copy (vecCells.begin() + y * siWidth + span.left,
+                   vecCells.begin() + y * siWidth + span.right + 1,
+                   vecShown.begin() + y * siWidth + span.left);
+
+        span = SPAN {siWidth, -1};
+    }
+    bDirty = false;
+}
+
+
+/******************************************************************************
+ *  @function   vInvalidate
+ *
+ *  @brief      Forgets content shown on console, so the complete frame
+ *              will be emitted next time
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void FrameBuffer::vInvalidate()
+{
+    std::fill (vecShown.begin(), vecShown.end(), CELL {CELL_UNKNOWN, 0});
+    std::fill (vecDirty.begin(), vecDirty.end(), SPAN {0, (short)(siWidth - 1)});
+
+    bDirty         = true;
+    siDirty_Top    = 0;
+    siDirty_Bottom = siHeight - 1;
+}
+
+
+/******************************************************************************
+ *  @function   vGrow
+ *
+ *  @brief      Appends blank lines to the frame
+ *
+ *  @param      height : New number of lines
+ *  @return     -
+ ******************************************************************************/
+
+void FrameBuffer::vGrow (short height)
+{
+    if (height <= siHeight) return;
+
+    // New lines are blank, their shown content is unknown
+    vecCells.resize (height * siWidth, CELL {CELL_BLANK,   ucBlankColor});
+    vecShown.resize (height * siWidth, CELL {CELL_UNKNOWN, 0});
+    vecDirty.resize (height,           SPAN {siWidth, -1});
+
+    for (short y = siHeight; y < height; y++)
+    {
+        vMark_Dirty (0, y);  vMark_Dirty (siWidth - 1, y);
+    }
+    siHeight = height;
+}
+
+
+/******************************************************************************
+ *  @function   vMark_Dirty
+ *
+ *  @brief      Extends dirty span of a row by a cell
+ *
+ *  @param      x, y : Cell coordinate
+ *  @return     -
+ ******************************************************************************/
+
+void FrameBuffer::vMark_Dirty (short x, short y)
+{
+    SPAN& span = vecDirty[y];
+
+    span.left  = std::min (span.left,  x);
+    span.right = std::max (span.right, x);
+
+    if (!bDirty)
+    {
+        siDirty_Top = siDirty_Bottom = y;  bDirty = true;  return;
+    }
+    siDirty_Top    = std::min (siDirty_Top,    y);
+    siDirty_Bottom = std::max (siDirty_Bottom, y);
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    FrameBuffer.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   FrameBuffer
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _FRAMEBUFFER_H_
+#define _FRAMEBUFFER_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <vector>
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Frame buffer dimension  ***/
+#define FRAME_WIDTH         80
+#define FRAME_HEIGHT        25      // Grows with content below last line
+
+/***  Cell values  ***/
+#define CELL_BLANK          ' '
+#define CELL_UNKNOWN        0       // Shown content not known -> redraw
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Off-screen character/color buffer. Keeps the current frame and the
+ *  frame shown on the console, plus the span of cells changed in
+ *  between for each row. Consecutive changed rows form a band, only
+ *  the bands have to be emitted: changes far apart cost no rows in
+ *  between.                                                           */
+
+class FrameBuffer
+{
+    public:
+    /** Types / Structs **/
+        typedef struct {unsigned char chr; unsigned char color;} CELL;
+        typedef struct {short left; short top; short right; short bottom;} REGION;
+
+    /** Constructor **/
+        FrameBuffer ();
+
+    /** Getter / Setter **/
+        short   siGet_Width     () const;
+        short   siGet_Height    () const;
+        CELL    tGet_Cell       (short x, short y) const;
+        CELL    tGet_Shown      (short x, short y) const;
+        bool    bIs_Changed     (short x, short y) const;
+        bool    bGet_Band       (short from, REGION& band) const;
+
+        void    vSet_Blank      (unsigned char color);
+
+    /** Further Member functions / methods **/
+        void    vPut            (short x, short y, unsigned char chr, unsigned char color);
+        void    vPut_Cells      (short x, short y, const CELL* cells, short count);
+        void    vClear          ();
+        void    vCommit         ();     // Dirty bands were emitted to console
+        void    vInvalidate     ();     // Shown content unknown, redraw all
+
+    private:
+    /** Types / Structs **/
+        typedef struct {short left; short right;} SPAN;     // left > right: clean
+
+    /** Variables **/
+        short               siWidth, siHeight;
+        unsigned char       ucBlankColor;
+        bool                bDirty;
+        short               siDirty_Top, siDirty_Bottom;   // Rows with changes
+
+        std::vector<CELL>   vecCells;   // Current frame
+        std::vector<CELL>   vecShown;   // Frame on console
+        std::vector<SPAN>   vecDirty;   // Changed cells per row
+
+    /** Member functions / methods **/
+        void    vGrow           (short height);
+        void    vMark_Dirty     (short x, short y);
+};
+
+#endif // _FRAMEBUFFER_H_
@@ -29,16 +29,20 @@
  *  @function   Constructor of class Game
  *
  *  @brief      * Instantiates a Game object
- *              * Starts the game
- *  @param      -
+ *              * Runs the game session until the player quits
+ *  @param      _pRecorder : Record writer for finished and aborted games,
+ *                           NULL if games are not recorded
  ******************************************************************************/
 
 
-Game::Game()
+Game::Game (RecordWriter* _pRecorder)
 {
     DEBUG_CONSTRUCTOR;
 
-    vInitGame();
+    siDrop_Frames = 0;
+    pRecorder     = _pRecorder;
+
+    vSessionLoop();
 }
 
 
@@ -54,30 +58,64 @@ Game::~Game()
 }
 
 
+/******************************************************************************
+ *  @function   vSessionLoop
+ *
+ *  @brief      Drives the game session as state machine
+ *              menu -> playing -> result -> menu ...
+ *              Each game returns to this loop, so the stack does not grow
+ *              with the number of games played.
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void Game::vSessionLoop()
+{
+    tSession = SESSION_MENU;
+
+    while (tSession != SESSION_QUIT)
+    {
+        switch (tSession)
+        {
+            /***  Reset game and wait for menu selection  ***/
+            case SESSION_MENU    :  vInitGame();
+                                    tSession = bMenuLoop() ? SESSION_PLAYING
+                                                           : SESSION_QUIT;
+                                    break;
+
+            /***  Play until game end or abort by user  ***/
+            case SESSION_PLAYING :  tSession = bGameLoop() ? SESSION_RESULT
+                                                           : SESSION_MENU;
+                                    break;
+
+            /***  Show game result and return to menu  ***/
+            case SESSION_RESULT  :  if   (siWinner > 0) vShow_WinnerInfo();
+                                    else                vShow_TieGameInfo();
+                                    tSession = SESSION_MENU;
+                                    break;
+
+            default              :  tSession = SESSION_QUIT;
+        }
+    }
+}
+
+
 /******************************************************************************
  *  @function   vInitGame
  *
  *  @brief      * Sets initial default values
  *              * Prints screen elements (game board, menu, etc.)
  *              * Saves cursor position of each screen element
- *              * Starts menu and game loop
  *  @param      -
  *  @return     -
  ******************************************************************************/
 
 void Game::vInitGame()
 {
-    system("CLS");
-
-    // Reset first player
-    if   ( siGet_StartPlayer() == PLAYER_1_ID )
-         { vSet_StartPlayer (oPlayer_H, true  );
-           vSet_StartPlayer (oPlayer_M, false ); }
-    else { vSet_StartPlayer (oPlayer_H, false );
-           vSet_StartPlayer (oPlayer_M, true  ); }
+    vClear_Screen();
 
-    siWinner = 0;       // Init / Reset winner state
-    vClear_Board();     // Reset 2D vector (game board) to zero
+    siWinner = 0;           // Init / Reset winner state
+    oGameState.vReset();    // Empty game board, first player to move
 
     // Print screen elements and save cursor
     // position of each screen element
@@ -86,27 +124,32 @@ void Game::vInitGame()
     Pos_Board      = tCurPos_Get();  vDraw_Board();
     Pos_GameInfo   = tCurPos_Get();  vShow_GameCfg();
     Pos_Menu       = tCurPos_Get();  vMenu_Main();
-
-    vMenuLoop ();
-    vGameLoop ();
 }
 
 
 /******************************************************************************
- *  @function   vGameLoop
+ *  @function   bGameLoop
  *
- *  @brief      Start of the game in a loop
+ *  @brief      Start of the game in a loop. The game flow is driven by
+ *              a match which reports what it is waiting for.
  *              * For Human player reads keyboard interaction for slot selection
- *              * For Machine player generates a random slot
- *              * Checks for winner or tie game -> end of game
+ *              * For Machine player requests the machine players move
+ *              * Animates token drop
+ *              * Match checks for winner or tie game -> end of game
  *  @param      -
- *  @return     -
+ *  @return     bool : true   if game ended with a winner or tie game
+ *                     false  if game was aborted by user
  ******************************************************************************/
 
-void Game::vGameLoop()
+bool Game::bGameLoop()
 {
-    short key, slot, free_slots;
-    short free_fields = siGet_FreeFields();
+    short              key, slot;
+    unsigned long long input = 0, inserted = 0;     // Steady clock [ns]
+
+    // Player 1 is the human player, player 2 the machine player
+    oMatch = Match (oGameState, false, true);
+    oMatch.vSet_Animation (!bGet_Turbo());
+    siDrop_Frames = 0;
 
     vCurPos_Set (Pos_GameInfo);  vClear_Below (12, 45);
 
@@ -115,78 +158,127 @@ void Game::vGameLoop()
     /******************************************************************
     *   Enter game loop until a player won or no moves left (tie game)
     *******************************************************************/
-    while (siWinner == 0 && free_fields > 0)
+    while (oMatch.tGet_Phase() != Match::FINISHED)
     {
-        /***  Human players move  ***/
-        if (siGet_CurrentPlayer() == PLAYER_1_ID)
+        oGameState = oMatch.oGet_GameState();   // Update shown game state
+
+        switch (oMatch.tGet_Phase())
         {
-            vCurPos_Set (Pos_SlotSelect);
-            vShow_SlotSelect (siGet_SlotSelection(), COL_YELLOW);
-
-            vShow_GameState();
-
-            // Read keys for menu interaction
-            key = oKey.iReadKeys ({KEY_LEFT, KEY_RIGHT, KEY_SPACE, KEY_a, KEY_A});
-
-            switch (key)
-            {
-                case KEY_LEFT  :  vSlotSelect_LShift();  break;     // Move token one step left
-                case KEY_RIGHT :  vSlotSelect_RShift();  break;     // Move token one step right
-
-                                  // If token insertion was successful
-                case KEY_SPACE :  if (bInsert_Token (PLAYER_1_ID, siGet_SlotSelection()))
-                                  {
-                                      vCurPos_Set (Pos_Board);
-                                      vAnimate_TokenDrop (PLAYER_1_ID, siGet_SlotSelection());
-                                      vToggle_CurrentPlayer();      // Switch human -> machine player
-                                  }
-                                  else BEEP_FULL_SLOT;  break;
-                case KEY_a     :
-                case KEY_A     :  vInitGame();          break;
-                default        :  _Exit(1);
-            }
+            /***  Human players move  ***/
+            case Match::AWAIT_HUMAN :
+
+                vCurPos_Set (Pos_SlotSelect);
+                vShow_SlotSelect (siGet_SlotSelection(), COL_YELLOW);
+
+                vShow_GameState();
+
+                // Read keys for menu interaction
+                key   = oKey.iReadKeys ({KEY_LEFT, KEY_RIGHT, KEY_SPACE, KEY_a, KEY_A});
+                input = ullGet_KeyTime();           // Key received, not read
+
+                switch (key)
+                {
+                    case KEY_LEFT  :  vSlotSelect_LShift();  break;     // Move token one step left
+                    case KEY_RIGHT :  vSlotSelect_RShift();  break;     // Move token one step right
+
+                                      // Drop token, switches human -> machine player
+                    case KEY_SPACE :  if (!oMatch.bSupply_Move (siGet_SlotSelection()))
+                                          BEEP_FULL_SLOT;
+                                      else
+                                      {
+                                          inserted = Latency::ullGet_Time();
+                                          Latency::vRecord (Latency::INPUT_TO_INSERT, inserted - input);
+                                      }
+                                      break;
+                    case KEY_a     :                        // Abort game, recorded unfinished
+                    case KEY_A     :  if (pRecorder) pRecorder->vAppend (GameRecord (oGameState, RECORD_UNFINISHED, uiGet_Seed()));
+                                      return false;
+                    default        :  _Exit(1);
+                }
+                break;
+
+            /***  Machine players move  ***/
+            case Match::AWAIT_MACHINE :
+
+                vCurPos_Set (Pos_SlotSelect); vShow_SlotSelect(0, 0);
+                vShow_GameState();
+
+                // Drop token, switches machine -> human player
+                {
+                    Latency::Timer oThink (Latency::ENGINE_THINK);
+                    slot = siMachine_Move (oGameState);
+                }
+                oMatch.bSupply_Move (slot);
+                inserted = Latency::ullGet_Time();
+
+                // Show token above selected slot
+                vCurPos_Set (Pos_SlotSelect);
+                vShow_SlotSelect (slot, COL_RED);  vWait(500);
+                break;
+
+            /***  Animate dropping of token in slot  ***/
+            case Match::AWAIT_FRAME :
+
+                vAnimate_Frame();
+                if (oMatch.tGet_Phase() != Match::AWAIT_FRAME)
+                    Latency::vRecord (Latency::INSERT_TO_ANIMATED, Latency::ullGet_Time() - inserted);
+                break;
+
+            default : break;
         }
-        /***  Machine players move  ***/
-        else
-        {
-            vCurPos_Set (Pos_SlotSelect); vShow_SlotSelect(0, 0);
-            vShow_GameState();
+    }
 
-            // Check how many free slots left and
-            // step out if board is full (no more possible moves)
-            free_slots = siGet_FreeSlots();
-            if (free_slots == 0) _Exit(1);
+    oGameState = oMatch.oGet_GameState();
+    siWinner   = oMatch.siGet_Winner();
 
-            // Generate a random slot for machine player move
-            slot = oRandomNr.iRndNum (1, free_slots);
-            slot = siGet_FreeSlotNr (slot);
+    if (pRecorder) pRecorder->vAppend (GameRecord (oGameState, siWinner, uiGet_Seed()));
 
-            // Insert token in randomized slot
-            bInsert_Token (PLAYER_2_ID, slot);
+    vCurPos_Set (Pos_SlotSelect); vShow_SlotSelect(0, 0);   // Update slot selection line
 
-            // Show toke above randomized slot
-            vCurPos_Set (Pos_SlotSelect);
-            vShow_SlotSelect (slot, COL_RED);  Sleep(500);
+    return true;
+}
 
-            // Animate dropping of token in slot
-            vCurPos_Set (Pos_Board);
-            vAnimate_TokenDrop (PLAYER_2_ID, slot);
 
-            // Switch machine -> human player
-            vCurPos_Set (Pos_Board);
-            vToggle_CurrentPlayer();
-        }
-        // Check if someone has won and ow many free slots left
-        siWinner    = siCheck_WinState();
-        free_fields = siGet_FreeFields();
+/******************************************************************************
+ *  @function   vAnimate_Frame
+ *
+ *  @brief      Shows the token drop step which is due by monotonic clock
+ *              and supplies one match frame per board line passed.
+ *              * Late steps are skipped, animation speed does not depend
+ *                on drawing time
+ *              * Waits until next step is due, a key press ends the wait
+ *                and skips the rest of the animation (key stays queued)
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void Game::vAnimate_Frame()
+{
+    using namespace std::chrono;
+
+    // First frame of this token drop starts the clock
+    if (siDrop_Frames == 0)
+    {
+        siDrop_Frames = oMatch.siGet_FramesLeft();
+        tDrop_Start   = steady_clock::now();
+        vCursor_Visible (false);                // Hide cursor
     }
 
-    vCurPos_Set (Pos_SlotSelect); vShow_SlotSelect(0, 0);   // Update slot selection line
+    short last_step = 2 * siDrop_Frames - 1;    // Two screen rows per board line
+    long  elapsed   = duration_cast<milliseconds> (steady_clock::now() - tDrop_Start).count();
+    short step      = std::min<long> (elapsed / DROP_STEP_MS, last_step);
+
+    if (bKey_Ready (0)) step = last_step;       // Key skips animation
+
+    vCurPos_Set (Pos_Board);
+    vAnimate_TokenDrop (oMatch.siGet_LastPlayer(), oMatch.siGet_LastSlot(), step);
+
+    // Match continues with next turn after last frame
+    while (oMatch.siGet_FramesLeft() > siDrop_Frames - (step + 1) / 2)  oMatch.vSupply_Frame();
 
-    if   (siWinner > 0) vShow_WinnerInfo();     // Print winner information
-    else                vShow_TieGameInfo();    // Print tie game information
+    if (step == last_step) {siDrop_Frames = 0;  return;}
 
-    vInitGame();    // ReInit the game
+    vWait ((step + 1) * DROP_STEP_MS - elapsed);    // Until next step is due
 }
 
 
@@ -205,10 +297,10 @@ void Game::vShow_GameState()
     /***  Human players move  ***/
     if (siGet_CurrentPlayer() == PLAYER_1_ID)
     {
-        std::cout <<
+        oScreen <<
         "  -------------------------------------------\n";
-        std::cout << "  "; vColor_Set(COL_YELLOW); std::cout << "  "; vColor_Restore();
-        std::cout <<
+        oScreen << "  "; vColor_Set(COL_YELLOW); oScreen << "  "; vColor_Restore();
+        oScreen <<
         " Player 1  (Human)                           \n"
         "                                             \n"
         "     Please select slot and drop token       \n"
@@ -225,17 +317,17 @@ void Game::vShow_GameState()
     /***  Machine players move  ***/
     else
     {
-        std::cout <<
+        oScreen <<
         "  -------------------------------------------\n";
-        std::cout << "  "; vColor_Set(COL_RED); std::cout << "  "; vColor_Restore();
-        std::cout <<
+        oScreen << "  "; vColor_Set(COL_RED); oScreen << "  "; vColor_Restore();
+        oScreen <<
         " Player 2  (Computer)                        \n"
         "                                             \n"
         "     Calculating move...  Please wait        \n"
         "  -------------------------------------------\n"
         << std::endl;
 
-        vClear_Below (5, 50);  Sleep(750);
+        vClear_Below (5, 50);  vWait(750);
     }
 }
 
@@ -254,28 +346,28 @@ void Game::vShow_WinnerInfo()
 
     vColor_Save();
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_GREY_BLUE);
-    std::cout << "                                       " << std::endl;
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_GREY_BLUE);
+    oScreen << "                                       " << std::endl;
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_GREY_BLACK);
-    std::cout << "  !!!  C O N R A T U L A T I O N  !!!  " << std::endl;
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_GREY_BLACK);
+    oScreen << "  !!!  C O N R A T U L A T I O N  !!!  " << std::endl;
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_GREY_BLUE);
-    std::cout << "                                       " << std::endl;
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_GREY_BLUE);
+    oScreen << "                                       " << std::endl;
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_GREY_BLUE);
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_GREY_BLUE);
     if (siWinner == PLAYER_1_ID)
-    std::cout << "     Player 1 (Human) won the game     " << std::endl;
+    oScreen << "     Player 1 (Human) won the game     " << std::endl;
     else
-    std::cout << "   Player 2 (Computer)  won the game   " << std::endl;
+    oScreen << "   Player 2 (Computer)  won the game   " << std::endl;
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_GREY_BLUE);
-    std::cout << "                                       " << std::endl;
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_GREY_BLUE);
+    oScreen << "                                       " << std::endl;
 
     vColor_Restore();  vClear_Below (5, 50);
-    std::cout << "\n  Press a key to continue..."          << std::endl;
+    oScreen << "\n  Press a key to continue..."          << std::endl;
 
-    getch();
+    oKey.vWaitKey();
 }
 
 
@@ -293,23 +385,23 @@ void Game::vShow_TieGameInfo()
 
     vColor_Save();
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_RED_WHITE);
-    std::cout << "                                  " << std::endl;
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_RED_WHITE);
+    oScreen << "                                  " << std::endl;
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_RED_WHITE);
-    std::cout << "  !!!  Game ended undecided  !!!  " << std::endl;
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_RED_WHITE);
+    oScreen << "  !!!  Game ended undecided  !!!  " << std::endl;
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_RED_WHITE);
-    std::cout << "                                  " << std::endl;
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_RED_WHITE);
+    oScreen << "                                  " << std::endl;
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_RED_WHITE);
-    std::cout << "      No player won the game      " << std::endl;
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_RED_WHITE);
+    oScreen << "      No player won the game      " << std::endl;
 
-    vColor_Restore(); std::cout << "  "; vColor_Set(COL_RED_WHITE);
-    std::cout << "                                  " << std::endl;
+    vColor_Restore(); oScreen << "  "; vColor_Set(COL_RED_WHITE);
+    oScreen << "                                  " << std::endl;
 
     vColor_Restore();  vClear_Below (5, 50);
-    std::cout << "\n  Press a key to continue..."          << std::endl;
+    oScreen << "\n  Press a key to continue..."          << std::endl;
 
-    getch();
+    oKey.vWaitKey();
 }
@@ -24,11 +24,14 @@
 =============================================================================*/
 
 /*------  System interface includes  -------*/
+#include <algorithm>        // std::min
+#include <chrono>
 #include <iostream>
-#include <conio.h>          // getch()
 
 /*------  Module includes  -------*/
 #include "Dialog.hpp"
+#include "Match.hpp"
+#include "RecordWriter.hpp"
 
 /*=============================================================================
 =====                               CLASSES                               =====
@@ -38,18 +41,33 @@ class Game : public Dialog
 {
     public:
     /** Constructor / Destructor **/
-                 Game();
+                 Game (RecordWriter* _pRecorder = NULL);
         virtual ~Game();
 
     protected:
 
     private:
+    /** Types / Structs **/
+        typedef enum {SESSION_MENU, SESSION_PLAYING,
+                      SESSION_RESULT, SESSION_QUIT} SESSION;
+
     /** Variables **/
         short   siWinner;
+        SESSION tSession;
+
+        std::chrono::steady_clock::time_point tDrop_Start;   // Start of token drop
+        short   siDrop_Frames;  // Frames of running token drop, 0 if none
+
+    /** Objects **/
+        Match   oMatch;         // Game flow of the running game
+
+        RecordWriter* pRecorder;    // Records played games if set
 
     /** Member functions / methods **/
+        virtual void vSessionLoop();
         virtual void vInitGame();
-        virtual void vGameLoop();
+        virtual bool bGameLoop();
+        virtual void vAnimate_Frame();
 
         virtual void vShow_GameState();
         virtual void vShow_WinnerInfo();
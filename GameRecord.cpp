@@ -0,0 +1,276 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    GameRecord.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Game record
+ *           Packs a played game into a few bytes (header and 4 bits
+ *           per move) and unpacks it again.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "GameRecord.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class GameRecord
+ *
+ *  @brief      Instantiates an empty record with default rules
+ *  @param      -
+ ******************************************************************************/
+
+GameRecord::GameRecord()
+{
+    tBoardSize    = {BOARD_SLOTS, BOARD_LINES};
+    siWinTokens   = WIN_TOKENS;
+    siStartPlayer = PLAYER_1_ID;
+    siWinner      = RECORD_UNFINISHED;
+    uiSeed        = 0;
+    siMoveCnt     = 0;
+}
+
+
+/******************************************************************************
+ *  @function   Constructor of class GameRecord
+ *
+ *  @brief      Instantiates a record of a game
+ *
+ *  @param      _oGameState : Rules and moves of the game
+ *              _siWinner   : 0 tie game, player ID of winner or
+ *                            RECORD_UNFINISHED
+ *              _uiSeed     : Seed of machine player random engine
+ ******************************************************************************/
+
+GameRecord::GameRecord (const GameState& _oGameState, short _siWinner, unsigned int _uiSeed)
+{
+    tBoardSize    = _oGameState.tGet_BoardSize();
+    siWinTokens   = _oGameState.siGet_WinTokens();
+    siStartPlayer = _oGameState.siGet_StartPlayer();
+    siWinner      = _siWinner;
+    uiSeed        = _uiSeed;
+    siMoveCnt     = _oGameState.siGet_MoveCount();
+
+    for (short i = 0; i < siMoveCnt; i++)  aMoves[i] = _oGameState.siGet_Move (i) - 1;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_BoardSize
+ *
+ *  @brief      Returns board size of the game
+ *  @param      -
+ *  @return     tBoardSize : Number of slots and lines
+ ******************************************************************************/
+
+GameRecord::BOARD GameRecord::tGet_BoardSize() const
+{
+    return tBoardSize;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_WinTokens
+ *
+ *  @brief      Returns number of tokens in a row to win
+ *  @param      -
+ *  @return     siWinTokens : Tokens to win
+ ******************************************************************************/
+
+short GameRecord::siGet_WinTokens() const
+{
+    return siWinTokens;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_StartPlayer
+ *
+ *  @brief      Returns ID of the player who made the first move
+ *  @param      -
+ *  @return     siStartPlayer : PLAYER_1_ID || PLAYER_2_ID
+ ******************************************************************************/
+
+short GameRecord::siGet_StartPlayer() const
+{
+    return siStartPlayer;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Winner
+ *
+ *  @brief      Returns result of the game
+ *  @param      -
+ *  @return     siWinner : 0 tie game, player ID of winner or
+ *                         RECORD_UNFINISHED
+ ******************************************************************************/
+
+short GameRecord::siGet_Winner() const
+{
+    return siWinner;
+}
+
+
+/******************************************************************************
+ *  @function   uiGet_Seed
+ *
+ *  @brief      Returns seed of machine player random engine
+ *  @param      -
+ *  @return     uiSeed : Seed
+ ******************************************************************************/
+
+unsigned int GameRecord::uiGet_Seed() const
+{
+    return uiSeed;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_MoveCount
+ *
+ *  @brief      Returns number of moves played
+ *  @param      -
+ *  @return     siMoveCnt : Number of moves
+ ******************************************************************************/
+
+short GameRecord::siGet_MoveCount() const
+{
+    return siMoveCnt;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Move
+ *
+ *  @brief      Returns slot of a move
+ *
+ *  @param      nth_move : Move index (0 = first move)
+ *  @return     Slot number (1 ... slots)
+ ******************************************************************************/
+
+short GameRecord::siGet_Move (short nth_move) const
+{
+    return aMoves[nth_move] + 1;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Size
+ *
+ *  @brief      Returns size of the encoded record
+ *  @param      -
+ *  @return     Number of bytes
+ ******************************************************************************/
+
+size_t GameRecord::tGet_Size() const
+{
+    return RECORD_HEADER_SIZE + (siMoveCnt + 1) / 2;
+}
+
+
+/******************************************************************************
+ *  @function   oReplay
+ *
+ *  @brief      Rebuilds the game by playing all moves
+ *  @param      -
+ *  @return     Game state after last move
+ ******************************************************************************/
+
+GameState GameRecord::oReplay() const
+{
+    GameState oGameState;
+
+    oGameState.vSet_BoardSize   (tBoardSize);
+    oGameState.vSet_WinTokens   (siWinTokens);
+    oGameState.vSet_StartPlayer (siStartPlayer);
+
+    for (short i = 0; i < siMoveCnt; i++)  oGameState.bPlay_Move (aMoves[i] + 1);
+
+    return oGameState;
+}
+
+
+/******************************************************************************
+ *  @function   tEncode
+ *
+ *  @brief      Writes the packed record
+ *
+ *  @param      buf : Output, at least tGet_Size() bytes
+ *  @return     Number of bytes written
+ ******************************************************************************/
+
+size_t GameRecord::tEncode (unsigned char* buf) const
+{
+    size_t size = tGet_Size();
+
+    buf[0] = tBoardSize.slot << 4 | tBoardSize.line;
+    buf[1] = siWinTokens << 4 | (siStartPlayer - 1) << 2 | siWinner;
+    buf[2] = siMoveCnt;
+    buf[3] = uiSeed;        buf[4] = uiSeed >> 8;
+    buf[5] = uiSeed >> 16;  buf[6] = uiSeed >> 24;
+
+    // Two moves per byte, first move in low nibble
+    for (short i = 0; i < siMoveCnt; i += 2)
+    {
+        unsigned char high = (i + 1 < siMoveCnt) ? aMoves[i + 1] : 0;
+
+        buf[RECORD_HEADER_SIZE + i / 2] = high << 4 | aMoves[i];
+    }
+    return size;
+}
+
+
+/******************************************************************************
+ *  @function   tDecode
+ *
+ *  @brief      Reads a packed record
+ *
+ *  @param      buf         : Encoded record
+ *              len         : Bytes available in buf
+ *              header_only : true   unpacks only the first move
+ *                                   (statistics without replay)
+ *  @return     Number of bytes read, 0 if record is invalid or incomplete
+ ******************************************************************************/
+
+size_t GameRecord::tDecode (const unsigned char* buf, size_t len, bool header_only)
+{
+    if (len < RECORD_HEADER_SIZE) return 0;
+
+    tBoardSize    = {(short)(buf[0] >> 4), (short)(buf[0] & 0x0F)};
+    siWinTokens   = buf[1] >> 4;
+    siStartPlayer = ((buf[1] >> 2) & 1) + 1;
+    siWinner      = buf[1] & 3;
+    siMoveCnt     = buf[2];
+    uiSeed        = buf[3] | buf[4] << 8 | buf[5] << 16 | (unsigned int)buf[6] << 24;
+
+    if (tBoardSize.slot < BOARD_SLOTS_MIN || tBoardSize.line < BOARD_LINES_MIN ||
+        siWinTokens     < WIN_TOKENS_MIN  ||
+        siMoveCnt       > tBoardSize.slot * tBoardSize.line  ||
+        len             < tGet_Size())     return 0;
+
+    short unpack = (header_only && siMoveCnt > 1) ? 1 : siMoveCnt;
+
+    for (short i = 0; i < unpack; i++)
+    {
+        unsigned char packed = buf[RECORD_HEADER_SIZE + i / 2];
+
+        aMoves[i] = (i % 2 == 0) ? packed & 0x0F : packed >> 4;
+
+        if (aMoves[i] >= tBoardSize.slot) return 0;
+    }
+    return tGet_Size();
+}
@@ -0,0 +1,104 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    GameRecord.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   GameRecord
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _GAMERECORD_H_
+#define _GAMERECORD_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <cstddef>      // size_t
+
+/*------  Module header includes  -------*/
+#include "GameState.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Record file layout  ***
+ *
+ *  File   : Sequence of blocks, written append-only
+ *  Block  : "CF4R", payload size (4 bytes LE), records (payload)
+ *           Records never cross block boundaries, so a file can be
+ *           split into blocks without decoding any record.
+ *  Record : Byte 0    slots << 4 | lines
+ *           Byte 1    win tokens << 4 | (start player - 1) << 2 | winner
+ *           Byte 2    number of moves
+ *           Byte 3-6  seed of machine player (LE)
+ *           Byte 7... moves, 4 bits each (slot - 1), first move in
+ *                     low nibble
+ */
+#define RECORD_MAGIC            "CF4R"
+#define RECORD_BLOCK_HEADER     8           // Magic, payload size
+#define RECORD_BLOCK_SIZE       65536       // Max. bytes per block
+#define RECORD_HEADER_SIZE      7
+#define RECORD_SIZE_MAX         (RECORD_HEADER_SIZE + (BOARD_FIELDS_MAX + 1) / 2)
+
+/***  Winner value of games not played to the end  ***/
+#define RECORD_UNFINISHED       3
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Value type of one recorded game: rules, start player, seed,
+ *  result and moves. Encodes to and decodes from the packed
+ *  record format.                                                     */
+
+class GameRecord
+{
+    public:
+    /** Types / Structs **/
+        typedef GameState::BOARD BOARD;
+
+    /** Constructor **/
+        GameRecord ();
+        GameRecord (const GameState& _oGameState, short _siWinner, unsigned int _uiSeed);
+
+    /** Getter / Setter **/
+        BOARD           tGet_BoardSize      () const;
+        short           siGet_WinTokens     () const;
+        short           siGet_StartPlayer   () const;
+        short           siGet_Winner        () const;
+        unsigned int    uiGet_Seed          () const;
+        short           siGet_MoveCount     () const;
+        short           siGet_Move          (short nth_move) const;
+        size_t          tGet_Size           () const;   // Encoded bytes
+
+    /** Further Member functions / methods **/
+        GameState       oReplay             () const;   // Play all moves
+        size_t          tEncode             (unsigned char* buf) const;
+        size_t          tDecode             (const unsigned char* buf, size_t len,
+                                             bool header_only = false);
+
+    private:
+    /** Variables **/
+        BOARD           tBoardSize;
+        short           siWinTokens;
+        short           siStartPlayer;
+        short           siWinner;
+        unsigned int    uiSeed;
+        short           siMoveCnt;
+
+        unsigned char   aMoves [BOARD_FIELDS_MAX];      // Slot index per move
+};
+
+#endif // _GAMERECORD_H_
@@ -0,0 +1,543 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    GameState.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Game state interface
+ *           Provides game rules, position, side to move and move history
+ *           without any console dependency.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::min
+#include <cstring>      // memset
+
+/*------  Module includes  -------*/
+#include "GameState.hpp"
+#include "LineTable.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class GameState
+ *
+ *  @brief      * Instantiates a GameState object
+ *              * Inits rules with default values and an empty board
+ *  @param      -
+ ******************************************************************************/
+
+GameState::GameState()
+{
+    siWinTokens   = WIN_TOKENS;
+    siStartPlayer = PLAYER_1_ID;
+
+    vSet_BoardSize (BOARD {BOARD_SLOTS, BOARD_LINES});
+}
+
+
+/******************************************************************************
+ *  @function   siGet_WinTokens
+ *
+ *  @brief      Returns number of tokens to win (token chain length)
+ *  @param      -
+ *  @return     siWinTokens : Number of tokens to win
+ ******************************************************************************/
+
+short GameState::siGet_WinTokens() const
+{
+    return siWinTokens;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_WinTokens_Max
+ *
+ *  @brief      Returns number of maximum tokens to win (token chain length).
+ *              This depends on shortest game board side length (slots or lines)
+ *  @param      -
+ *  @return     siWinTokens_Max : Number of maximum tokens to win
+ ******************************************************************************/
+
+short GameState::siGet_WinTokens_Max() const
+{
+    return siWinTokens_Max;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_BoardSize
+ *
+ *  @brief      Returns current game board size / dimension.
+ *  @param      -
+ *  @return     tBoardSize : Game board size as list of {slots, lines)
+ ******************************************************************************/
+
+GameState::BOARD GameState::tGet_BoardSize() const
+{
+    return tBoardSize;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Field
+ *
+ *  @brief      Returns value of a game board field element
+ *
+ *  @param      _FieldPos : Coordinate of field element as list {slot, line}
+ *  @return     aField    : Value of requested field
+ ******************************************************************************/
+
+short GameState::siGet_Field (BOARD _FieldPos) const
+{
+    return aField[_FieldPos.slot][_FieldPos.line];
+}
+
+
+/******************************************************************************
+ *  @function   siGet_SlotHeight
+ *
+ *  @brief      Returns number of tokens within a slot
+ *
+ *  @param      slot : Slot number (1 ... slots)
+ *  @return     aHeight : Number of tokens in slot
+ ******************************************************************************/
+
+short GameState::siGet_SlotHeight (short slot) const
+{
+    return aHeight[slot - 1];
+}
+
+
+/******************************************************************************
+ *  @function   siGet_FreeSlots
+ *
+ *  @brief      Returns number of slots which are not complete filled with tokens.
+ *  @param      -
+ *  @return     slot_count : Number of free slots
+ ******************************************************************************/
+
+short GameState::siGet_FreeSlots() const
+{
+    short slot_count = 0;
+
+    for (short slot = 0; slot < tBoardSize.slot; slot++)
+    {
+        if (aHeight[slot] < tBoardSize.line) slot_count++;
+    }
+    return slot_count;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_FreeSlotNr
+ *
+ *  @brief      Returns slot number of n-th free slot.
+ *              Example:  If slot 1 and 3 are full the 3rd free slot is slot 5
+ *  @param      nth_freeslot : Count of free slot that is requested
+ *  @return     slot_nr      : Number of n-th free slot
+ *
+ *  @note       slot_nr == 0 means the game board is full of tokens
+ *              and no more moves possible -> end of game
+ ******************************************************************************/
+
+short GameState::siGet_FreeSlotNr (short nth_freeslot) const
+{
+    for (short slot = 0; slot < tBoardSize.slot; slot++)
+    {
+        if (aHeight[slot] < tBoardSize.line) nth_freeslot--;
+        if (nth_freeslot == 0) return slot + 1;
+    }
+    return 0;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_FreeFields
+ *
+ *  @brief      Returns number of game board fields without a token.
+ *  @param      -
+ *  @return     Number of game board fields without a token
+ *
+ *  @note       Zero means the game board is full of tokens
+ *              and no more moves possible -> end of game
+ ******************************************************************************/
+
+short GameState::siGet_FreeFields() const
+{
+    return tBoardSize.slot * tBoardSize.line - siMoveCnt;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_StartPlayer
+ *
+ *  @brief      Returns ID of first player of the game
+ *  @param      -
+ *  @return     siStartPlayer : PLAYER_1_ID || PLAYER_2_ID
+ ******************************************************************************/
+
+short GameState::siGet_StartPlayer() const
+{
+    return siStartPlayer;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_CurrentPlayer
+ *
+ *  @brief      Returns ID of the player to move
+ *  @param      -
+ *  @return     siCurrentPlayer : PLAYER_1_ID || PLAYER_2_ID
+ ******************************************************************************/
+
+short GameState::siGet_CurrentPlayer() const
+{
+    return siCurrentPlayer;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_MoveCount
+ *
+ *  @brief      Returns number of moves played so far
+ *  @param      -
+ *  @return     siMoveCnt : Number of moves in move history
+ ******************************************************************************/
+
+short GameState::siGet_MoveCount() const
+{
+    return siMoveCnt;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Move
+ *
+ *  @brief      Returns slot number of a move from move history
+ *
+ *  @param      nth_move : Index of move in history (0 = first move)
+ *  @return     Slot number (1 ... slots) the token was dropped into
+ ******************************************************************************/
+
+short GameState::siGet_Move (short nth_move) const
+{
+    return aMoves[nth_move] + 1;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Packed
+ *
+ *  @brief      Returns the board as packed lanes (updated on each move)
+ *  @param      -
+ *  @return     tPacked : Packed position, equal for equal boards
+ ******************************************************************************/
+
+GameState::PACKED GameState::tGet_Packed() const
+{
+    return tPacked;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Canonical
+ *
+ *  @brief      Returns the smaller one of the packed board and its mirror
+ *              image across the middle slot. Both boards are equivalent,
+ *              so tables keyed by the canonical board hold each only once.
+ *
+ *  @param      mirrored : Receives true if the mirror image was returned
+ *                         (slot s of the board is slot (slots + 1 - s))
+ *  @return     Canonical packed position
+ ******************************************************************************/
+
+GameState::PACKED GameState::tGet_Canonical (bool* mirrored) const
+{
+    PACKED mirror = tMirror (tPacked, tBoardSize.slot);
+    bool   less   = bPacked_Less (mirror, tPacked);
+
+    if (mirrored != NULL) *mirrored = less;
+
+    return less ? mirror : tPacked;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_WinTokens
+ *
+ *  @brief      Sets number of tokens to win (token chain length)
+ *
+ *  @param      _siWinTokens : Number of tokens to win
+ *  @return     -
+ ******************************************************************************/
+
+void GameState::vSet_WinTokens (short _siWinTokens)
+{
+    siWinTokens = _siWinTokens;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_BoardSize
+ *
+ *  @brief      Sets game board size / dimension and clears the board.
+ *
+ *  @param      _aBoardSize : Game board size as list of {slots, lines)
+ *  @return     -
+ ******************************************************************************/
+
+void GameState::vSet_BoardSize (BOARD _aBoardSize)
+{
+    tBoardSize.slot = _aBoardSize.slot;
+    tBoardSize.line = _aBoardSize.line;
+
+    siWinTokens_Max = std::min (tBoardSize.slot, tBoardSize.line);
+
+    // Set maximum number of tokens to win,
+    // based of shortest game board side length
+    if (siWinTokens_Max < siWinTokens)  siWinTokens = siWinTokens_Max;
+
+    vReset();   // Recreate game board with new dimensions
+}
+
+
+/******************************************************************************
+ *  @function   vSet_StartPlayer
+ *
+ *  @brief      Sets the first player for the game and resets the game.
+ *
+ *  @param      _siStartPlayer : PLAYER_1_ID || PLAYER_2_ID
+ *  @return     -
+ ******************************************************************************/
+
+void GameState::vSet_StartPlayer (short _siStartPlayer)
+{
+    siStartPlayer = _siStartPlayer;
+
+    vReset();
+}
+
+
+/******************************************************************************
+ *  @function   vReset
+ *
+ *  @brief      Clears game board and move history.
+ *              The start player is set as player to move.
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void GameState::vReset()
+{
+    memset (aField,  FIELDVAL_EMPTY, sizeof(aField));
+    memset (aHeight, 0,              sizeof(aHeight));
+
+    siMoveCnt       = 0;
+    siCurrentPlayer = siStartPlayer;
+
+    // Marker of empty slots in lowest bit, lanes of missing slots stay zero
+    memset (&tPacked, 0, sizeof(tPacked));
+    for (short slot = 0; slot < tBoardSize.slot; slot++)
+        tPacked.word[slot / 4] |= 1ULL << (slot % 4 * PACKED_LANE_BITS);
+}
+
+
+/******************************************************************************
+ *  @function   bCan_Play
+ *
+ *  @brief      Checks if a token can be dropped into a slot
+ *
+ *  @param      slot : Slot number (1 ... slots)
+ *  @return     bool : true   if slot exists and is not full of tokens
+ *                     false  otherwise
+ ******************************************************************************/
+
+bool GameState::bCan_Play (short slot) const
+{
+    return slot >= 1  &&  slot <= tBoardSize.slot  &&
+           aHeight[slot - 1] < tBoardSize.line;
+}
+
+
+/******************************************************************************
+ *  @function   bPlay_Move
+ *
+ *  @brief      Drops a token of the current player into the next free line
+ *              of a slot, records the move and passes the turn.
+ *
+ *  @param      slot : Slot number (1 ... slots)
+ *  @return     bool : true   if token insert successful
+ *                     false  if slot is full of tokens
+ ******************************************************************************/
+
+bool GameState::bPlay_Move (short slot)
+{
+    if (!bCan_Play (slot)) return false;
+
+    slot--;   // Remap slot number to array index count
+
+    // Lines are counted from top, so the next free line is above the tokens
+    aField[slot][tBoardSize.line - 1 - aHeight[slot]] = siCurrentPlayer;
+
+    // Adding moves the marker one bit up, its old bit becomes the token
+    tPacked.word[slot / 4] += (siCurrentPlayer == PLAYER_2_ID ? 2ULL : 1ULL)
+                              << (slot % 4 * PACKED_LANE_BITS + aHeight[slot]);
+    aHeight[slot]++;
+
+    aMoves[siMoveCnt++] = slot;
+
+    siCurrentPlayer = (siCurrentPlayer == PLAYER_1_ID) ? PLAYER_2_ID : PLAYER_1_ID;
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   bUndo_Move
+ *
+ *  @brief      Takes back the last move of the move history
+ *  @param      -
+ *  @return     bool : true   if a move was taken back
+ *                     false  if no move was played yet
+ ******************************************************************************/
+
+bool GameState::bUndo_Move()
+{
+    if (siMoveCnt == 0) return false;
+
+    short slot = aMoves[--siMoveCnt];
+
+    aHeight[slot]--;
+    aField[slot][tBoardSize.line - 1 - aHeight[slot]] = FIELDVAL_EMPTY;
+
+    tPacked.word[slot / 4] -= (siCurrentPlayer == PLAYER_2_ID ? 1ULL : 2ULL)    // Mover of
+                              << (slot % 4 * PACKED_LANE_BITS + aHeight[slot]);   // last move
+
+    siCurrentPlayer = (siCurrentPlayer == PLAYER_1_ID) ? PLAYER_2_ID : PLAYER_1_ID;
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   siCheck_WinState
+ *
+ *  @brief      Searches the winning lines of LineTable fitting into the
+ *              board for one filled by tokens of a single player.
+ *              Tokens of both players are taken from the packed board:
+ *              below the marker of a lane, a set bit is a token of
+ *              player 2, a clear bit a token of player 1.
+ *
+ *  @param      -
+ *  @return     WON_HUMAN || WON_MACHINE : ID of player that won the game
+ *              Zero if no player won, means no token chain had the winning length
+ ******************************************************************************/
+
+short GameState::siCheck_WinState() const
+{
+    const LineTable::LINE* pLines = LineTable::pGet_Lines (siWinTokens);
+    const short            words  = (tBoardSize.slot * PACKED_LANE_BITS + 63) / 64;   // Holding the board
+    PACKED                 placed = {};     // Bits below the markers
+
+    for (short slot = 0; slot < tBoardSize.slot; slot++)
+        placed.word[slot / 4] |= ((1ULL << aHeight[slot]) - 1) << (slot % 4 * PACKED_LANE_BITS);
+
+    for (long n = 0; n < LineTable::liCount (siWinTokens); n++)
+    {
+        const LineTable::LINE& line = pLines[n];
+        bool                   full = true, machine = true;
+
+        if (!LineTable::bFits (line, tBoardSize.slot, tBoardSize.line)) continue;
+
+        for (short i = 0; i < words && full; i++)
+            full = (placed.word[i] & line.cells.word[i]) == line.cells.word[i];
+
+        if (!full) continue;
+
+        // Line of tokens, won if all of one player
+        for (short i = 0; i < words; i++)
+            machine &= (tPacked.word[i] & line.cells.word[i]) == line.cells.word[i];
+
+        if (machine) return WON_MACHINE;
+
+        for (short i = 0; i < words && full; i++)
+            full = (tPacked.word[i] & line.cells.word[i]) == 0;
+
+        if (full) return WON_HUMAN;
+    }
+
+    return 0;
+}
+
+
+/******************************************************************************
+ *  @function   tMirror
+ *
+ *  @brief      Mirrors a packed board across the middle slot:
+ *              all lanes are reversed (words and lanes within each word
+ *              swapped), then shifted down by the lanes of missing slots.
+ *
+ *  @param      packed : Packed position
+ *              slots  : Number of slots of board
+ *  @return     Packed position of mirror image
+ ******************************************************************************/
+
+GameState::PACKED GameState::tMirror (const PACKED& packed, short slots)
+{
+    const unsigned long long LANES = 0x0000FFFF0000FFFFULL;
+
+    unsigned long long reversed[PACKED_WORDS];
+    PACKED             mirror;
+
+    for (short i = 0; i < PACKED_WORDS; i++)
+    {
+        unsigned long long x = packed.word[PACKED_WORDS - 1 - i];
+
+        x = x >> 32 | x << 32;
+        x = (x >> 16 & LANES) | (x & LANES) << 16;
+        reversed[i] = x;
+    }
+
+    short shift = (PACKED_WORDS * 64 / PACKED_LANE_BITS - slots) * PACKED_LANE_BITS;
+    short words = shift / 64, bits = shift % 64;
+
+    for (short i = 0; i < PACKED_WORDS; i++)
+    {
+        unsigned long long lo = i + words     < PACKED_WORDS ? reversed[i + words]     : 0;
+        unsigned long long hi = i + words + 1 < PACKED_WORDS ? reversed[i + words + 1] : 0;
+
+        mirror.word[i] = bits == 0 ? lo : lo >> bits | hi << (64 - bits);
+    }
+    return mirror;
+}
+
+
+/******************************************************************************
+ *  @function   bPacked_Less
+ *
+ *  @brief      Order of packed boards (highest word first)
+ *
+ *  @param      a, b : Packed positions
+ *  @return     bool : true  if a is sorted before b
+ ******************************************************************************/
+
+bool GameState::bPacked_Less (const PACKED& a, const PACKED& b)
+{
+    for (short i = PACKED_WORDS - 1; i >= 0; i--)
+    {
+        if (a.word[i] != b.word[i]) return a.word[i] < b.word[i];
+    }
+    return false;
+}
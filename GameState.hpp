@@ -0,0 +1,122 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    GameState.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   GameState
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _GAMESTATE_H_
+#define _GAMESTATE_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  Module header includes  -------*/
+#include "Player.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Game board attributes ***/
+#define BOARD_SLOTS       7
+#define BOARD_LINES       6
+#define WIN_TOKENS        4
+
+#define BOARD_SLOTS_MIN   3
+#define BOARD_SLOTS_MAX   15
+#define BOARD_LINES_MIN   3
+#define BOARD_LINES_MAX   15
+#define WIN_TOKENS_MIN    3
+
+#define BOARD_FIELDS_MAX  (BOARD_SLOTS_MAX * BOARD_LINES_MAX)
+
+/***  Game board field values  **/
+#define FIELDVAL_EMPTY    0
+#define FIELDVAL_HUMAN    1
+#define FIELDVAL_MACHINE  2
+
+/***  Packed position: one 16 bit lane per slot (slot 1 in lowest lane),  ***/
+/***  tokens from bottom (bit set: player 2) and a marker bit above them  ***/
+#define PACKED_LANE_BITS  16
+#define PACKED_WORDS      (BOARD_SLOTS_MAX * PACKED_LANE_BITS / 64 + 1)
+
+/***  Player wining IDs  ***/
+#define WON_HUMAN   FIELDVAL_HUMAN
+#define WON_MACHINE FIELDVAL_MACHINE
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Plain value type holding everything that makes up a game:
+ *  rules (board size, tokens to win), position, side to move and
+ *  move history. No console dependencies and no virtual methods,
+ *  so objects can be copied and stored in bulk.                       */
+
+class GameState
+{
+    public:
+    /** Types / Structs **/
+        typedef struct {short slot; short line;} BOARD;
+        typedef struct {unsigned long long word[PACKED_WORDS];} PACKED;
+
+    /** Constructor **/
+        GameState ();
+
+    /** Getter / Setter **/
+        short   siGet_WinTokens     () const;
+        short   siGet_WinTokens_Max () const;
+        BOARD   tGet_BoardSize      () const;
+        short   siGet_Field         (BOARD _FieldPos) const;
+        short   siGet_SlotHeight    (short slot) const;
+        short   siGet_FreeSlots     () const;
+        short   siGet_FreeSlotNr    (short nth_freeslot) const;
+        short   siGet_FreeFields    () const;
+        short   siGet_StartPlayer   () const;
+        short   siGet_CurrentPlayer () const;
+        short   siGet_MoveCount     () const;
+        short   siGet_Move          (short nth_move) const;
+        PACKED  tGet_Packed         () const;
+        PACKED  tGet_Canonical      (bool* mirrored = NULL) const;
+
+        void    vSet_WinTokens      (short _siWinTokens);
+        void    vSet_BoardSize      (BOARD _aBoardSize);
+        void    vSet_StartPlayer    (short _siStartPlayer);
+
+    /** Further Member functions / methods **/
+        void    vReset              ();     // Empty board, start player to move
+        bool    bCan_Play           (short slot) const;
+        bool    bPlay_Move          (short slot);
+        bool    bUndo_Move          ();
+        short   siCheck_WinState    () const;
+
+        static PACKED   tMirror         (const PACKED& packed, short slots);
+        static bool     bPacked_Less    (const PACKED& a, const PACKED& b);
+
+    private:
+    /** Variables **/
+        BOARD           tBoardSize;
+        short           siWinTokens, siWinTokens_Max;
+        short           siStartPlayer, siCurrentPlayer;
+        short           siMoveCnt;
+
+        unsigned char   aField  [BOARD_SLOTS_MAX][BOARD_LINES_MAX];   // Game board
+        unsigned char   aHeight [BOARD_SLOTS_MAX];                    // Tokens per slot
+        unsigned char   aMoves  [BOARD_FIELDS_MAX];                   // Slot index per move
+        PACKED          tPacked;                                      // Board as lanes
+};
+
+#endif // _GAMESTATE_H_
@@ -62,47 +62,42 @@ KeyHandler::~KeyHandler()
 template <class T>      // Template for variable argument list
 short KeyHandler::iReadKeys (std::initializer_list<T> key_list)
 {
-    bool key_ctrl_seq = false;
-    bool stop_keyread = false;
-    short key_pressed;
-
-    while ( !stop_keyread )
+    while (true)
     {
-        // Flush keyboard input buffer
-        FlushConsoleInputBuffer (GetStdHandle(STD_INPUT_HANDLE));
-
-        short key_read = getch();   // Read key
-
-        // Check for control key (like arrow keys) code sequence
-        // In case set an offset to requested key
-        if  (key_ctrl_seq) key_read += KEY_CTRL_OFFSET;
-
-        if  (key_read == KEY_CTRL_SEQ)
-             key_ctrl_seq = true;
+        // Keys typed ahead are queued, screen is shown when queue is empty
+        short key_read = oConsole.iRead_Key();
 
-        // Handle standard keys (non control keys)
-        else
+        // Check if key list contains the pressed key
+        for (auto key_request : key_list)
         {
-            // Check if key list contains the pressed key
-            for (auto key_request : key_list)
-            {
-                if (key_read == key_request)
-                {
-                    key_pressed  = key_read;
-                    stop_keyread = true;
-                    break;
-                }
-            }
-            // If a key was pressed which is not in key list
-            if (!stop_keyread) {BEEP_KEY;  key_ctrl_seq = false;}
+            if (key_read == key_request) return key_read;
         }
+        BEEP_KEY;           // Key was pressed which is not in key list
     }
-    return key_pressed;
 }
 template short KeyHandler::iReadKeys (std::initializer_list<int>);
 //template int KeyHandler::iReadKeys(std::initializer_list<const char*>);
 
 
+/******************************************************************************
+ *  @function   vWaitKey
+ *
+ *  @brief      Waits until any key is pressed
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void KeyHandler::vWaitKey()
+{
+    // Keys typed before the screen was shown are discarded,
+    // scripted input of turbo mode is kept
+    oConsole.vFlush();
+    if (!ConsoleControl::bGet_Turbo()) oConsole.vFlush_Input();
+
+    oConsole.iRead_Key();
+}
+
+
 /******************************************************************************
  *  @function   siGetNum
  *
@@ -114,31 +109,28 @@ template short KeyHandler::iReadKeys (std::initializer_list<int>);
 short KeyHandler::siGetNum()
 {
     std::string input = "";             // Numeric string
-    char chr;
-
-    // Flush keyboard input buffer
-    FlushConsoleInputBuffer (GetStdHandle(STD_INPUT_HANDLE));
+    int chr;
 
-    chr = getch();                      // Read key
+    chr = oConsole.iRead_Key();         // Read key
 
     // Read characters until Enter or backspace key
     while (chr != '\r')
     {
         if (chr >= '0' && chr <= '9')   // Add only numbers.
         {
-            std::cout << chr;
+            oConsole.vPrint (std::string (1, chr));
             input += chr;
         }
         else if (chr == 8)              // Backspace key
         {
             // Clear last character on screen
-            oConsole.vCursor_Move (-1, 0); std::cout << " ";
+            oConsole.vCursor_Move (-1, 0); oConsole.vPrint (" ");
             // Delete last character from input string
             oConsole.vCursor_Move (-1, 0); input.pop_back();
         }
         else BEEP_KEY;                  // Invalid key pressed
 
-        chr = getch();                  // Read next character
+        chr = oConsole.iRead_Key();     // Read next character
     }
     return ( (short)std::atoi(input.c_str()) );
 }
@@ -25,7 +25,6 @@
 
 /*------  System interface includes  -------*/
 #include <iostream>
-#include <conio.h>          // getch()
 
 /*------  Module header includes  -------*/
 #include "ConsoleControl.hpp"
@@ -56,8 +55,13 @@
 #define KEY_q               113
 
 /***  Warning sounds  **/
+#ifdef _WIN32
 #define BEEP_KEY            Beep(1000, 150)
 #define BEEP_FULL_SLOT      Beep( 300, 50 )
+#else
+#define BEEP_KEY            (std::cout << '\a' << std::flush)
+#define BEEP_FULL_SLOT      (std::cout << '\a' << std::flush)
+#endif
 
 /*=============================================================================
 =====                               CLASSES                               =====
@@ -73,6 +77,7 @@ class KeyHandler
     /** Member functions / methods **/
         template <typename T>       // Template for variable argument list
         short iReadKeys (std::initializer_list<T> key_list);
+        virtual void vWaitKey ();   // Wait for any key
 
     protected:
     /** Member functions / methods **/
@@ -0,0 +1,282 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Latency.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Turn latencies
+ *           Percentiles of the latency histograms, shown on exit and
+ *           exported as JSON or Prometheus text.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::min
+#include <cmath>        // std::ceil
+#include <cstdlib>      // atexit
+#include <fstream>
+#include <iomanip>      // std::setw, std::setprecision
+#include <iostream>
+#include <sstream>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "Latency.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Percentiles shown and exported  ***/
+static const double PERCENTS[4] = {50, 90, 99, 99.9};
+
+/***  Names of the phases  ***/
+static const char* PHASE_NAME[Latency::PHASES] =
+    {"input_to_insert", "insert_to_animated", "engine_think", "win_check", "render"};
+
+/*=============================================================================
+=====                           LOCAL FUNCTIONS                           =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   vShow_OnExit
+ *
+ *  @brief      Shows the histograms and writes the file set, called on exit
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+static void vShow_OnExit()
+{
+    Latency::vShow (std::cout);
+    Latency::bWrite (Latency::sGet_File());
+}
+
+/*=============================================================================
+=====                          STATIC VARIABLES                           =====
+=============================================================================*/
+
+Latency::HISTOGRAM  Latency::aHistograms[Latency::PHASES];
+std::string         Latency::sFile;
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   ullGet_Count
+ *
+ *  @brief      Returns the number of latencies recorded for a phase
+ *
+ *  @param      phase : Phase of a turn
+ *  @return     Number of latencies
+ ******************************************************************************/
+
+unsigned long long Latency::ullGet_Count (PHASE phase)
+{
+    return aHistograms[phase].ullCount.load (std::memory_order_relaxed);
+}
+
+
+/******************************************************************************
+ *  @function   ullGet_Percentile
+ *
+ *  @brief      Returns the latency a percentage of the recorded latencies
+ *              of a phase does not exceed (largest value of its bucket)
+ *
+ *  @param      phase   : Phase of a turn
+ *              percent : 0 ... 100
+ *  @return     Latency [ns], zero if none recorded
+ ******************************************************************************/
+
+unsigned long long Latency::ullGet_Percentile (PHASE phase, double percent)
+{
+    const HISTOGRAM&   histogram = aHistograms[phase];
+    unsigned long long count     = histogram.ullCount.load (std::memory_order_relaxed);
+    unsigned long long rank      = std::max (1.0, std::ceil (percent / 100 * count));
+    unsigned long long seen      = 0;
+
+    if (count == 0) return 0;
+
+    for (short bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+    {
+        seen += histogram.aBuckets[bucket].load (std::memory_order_relaxed);
+
+        if (seen >= rank) return std::min (ullValue (bucket), histogram.ullMax.load (std::memory_order_relaxed));
+    }
+    return histogram.ullMax.load (std::memory_order_relaxed);
+}
+
+
+/******************************************************************************
+ *  @function   sGet_File, vSet_File
+ *
+ *  @brief      File the histograms are written to on exit. Setting a file
+ *              also shows the histograms on exit.
+ *
+ *  @param      path : .prom or .txt for Prometheus text, else JSON
+ *  @return     sFile : File
+ ******************************************************************************/
+
+const std::string& Latency::sGet_File()
+{
+    return sFile;
+}
+
+void Latency::vSet_File (const std::string& path)
+{
+    if (sFile.empty()) atexit (vShow_OnExit);
+    sFile = path;
+}
+
+
+/******************************************************************************
+ *  @function   vShow
+ *
+ *  @brief      Prints count, mean, percentiles and maximum of each phase
+ *              with latencies recorded
+ *
+ *  @param      out : Stream
+ *  @return     -
+ ******************************************************************************/
+
+void Latency::vShow (std::ostream& out)
+{
+    out << std::fixed << std::setprecision(3)
+        << "  Latency [ms]            count      mean       p50       p90       p99     p99.9       max\n";
+
+    for (short phase = 0; phase < PHASES; phase++)
+    {
+        const HISTOGRAM&   histogram = aHistograms[phase];
+        unsigned long long count     = histogram.ullCount.load (std::memory_order_relaxed);
+
+        if (count == 0) continue;
+
+        out << "  " << std::setw(18) << std::left << PHASE_NAME[phase] << std::right << std::setw(11) << count
+            << std::setw(10) << histogram.ullSum.load (std::memory_order_relaxed) / 1e6 / count;
+
+        for (double percent : PERCENTS)
+            out << std::setw(10) << ullGet_Percentile ((PHASE)phase, percent) / 1e6;
+
+        out << std::setw(10) << histogram.ullMax.load (std::memory_order_relaxed) / 1e6 << "\n";
+    }
+}
+
+
+/******************************************************************************
+ *  @function   sGet_Json
+ *
+ *  @brief      Returns all phases as JSON object, latencies in nanoseconds
+ *  @param      -
+ *  @return     JSON object
+ ******************************************************************************/
+
+std::string Latency::sGet_Json()
+{
+    std::ostringstream out;
+
+    out << "{";
+    for (short phase = 0; phase < PHASES; phase++)
+    {
+        const HISTOGRAM& histogram = aHistograms[phase];
+
+        out << (phase > 0 ? ", " : "") << "\"" << PHASE_NAME[phase] << "\": {\"count\": "
+            << histogram.ullCount.load (std::memory_order_relaxed)
+            << ", \"sum_ns\": " << histogram.ullSum.load (std::memory_order_relaxed)
+            << ", \"max_ns\": " << histogram.ullMax.load (std::memory_order_relaxed);
+
+        for (double percent : PERCENTS)
+            out << ", \"p" << percent << "_ns\": " << ullGet_Percentile ((PHASE)phase, percent);
+
+        out << "}";
+    }
+    out << "}";
+
+    return out.str();
+}
+
+
+/******************************************************************************
+ *  @function   sGet_Prometheus
+ *
+ *  @brief      Returns all phases as Prometheus summary in text format,
+ *              latencies in seconds
+ *  @param      -
+ *  @return     Metrics text
+ ******************************************************************************/
+
+std::string Latency::sGet_Prometheus()
+{
+    std::ostringstream out;
+
+    out << std::setprecision(9)
+        << "# HELP connectfour_turn_latency_seconds Latency of the phases of a turn\n"
+        << "# TYPE connectfour_turn_latency_seconds summary\n";
+
+    for (short phase = 0; phase < PHASES; phase++)
+    {
+        const HISTOGRAM& histogram = aHistograms[phase];
+        std::string      label     = std::string ("phase=\"") + PHASE_NAME[phase] + "\"";
+
+        for (double percent : PERCENTS)
+            out << "connectfour_turn_latency_seconds{" << label << ",quantile=\"" << percent / 100 << "\"} "
+                << ullGet_Percentile ((PHASE)phase, percent) / 1e9 << "\n";
+
+        out << "connectfour_turn_latency_seconds_sum{"   << label << "} "
+            << histogram.ullSum.load (std::memory_order_relaxed) / 1e9 << "\n"
+            << "connectfour_turn_latency_seconds_count{" << label << "} "
+            << histogram.ullCount.load (std::memory_order_relaxed) << "\n";
+    }
+    return out.str();
+}
+
+
+/******************************************************************************
+ *  @function   bWrite
+ *
+ *  @brief      Writes all phases to a file
+ *
+ *  @param      path : .prom or .txt for Prometheus text, else JSON
+ *  @return     bool : false  if file can not be written
+ ******************************************************************************/
+
+bool Latency::bWrite (const std::string& path)
+{
+    std::string   extension = path.substr (std::min (path.size(), path.rfind ('.')));
+    std::ofstream file (path);
+
+    if (!file) return false;
+
+    if   (extension == ".prom" || extension == ".txt") file << sGet_Prometheus();
+    else file << sGet_Json() << "\n";
+
+    return (bool)file;
+}
+
+
+/******************************************************************************
+ *  @function   ullValue
+ *
+ *  @brief      Returns the largest latency of a bucket
+ *
+ *  @param      bucket : 0 ... LATENCY_BUCKETS - 1
+ *  @return     Latency [ns]
+ ******************************************************************************/
+
+unsigned long long Latency::ullValue (short bucket)
+{
+    if (bucket < (1 << LATENCY_SUB_BITS)) return bucket;
+
+    short              shift = (bucket >> LATENCY_SUB_BITS) - 1;
+    unsigned long long first = ((1ULL << LATENCY_SUB_BITS) + (bucket & ((1 << LATENCY_SUB_BITS) - 1))) << shift;
+
+    return first + ((1ULL << shift) - 1);
+}
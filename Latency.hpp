@@ -0,0 +1,148 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Latency.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   Latency
+ *  @class   Timer : Nested class within class Latency
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _LATENCY_H_
+#define _LATENCY_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <string>
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Histogram buckets: values below 2^SUB_BITS exact, above 2^SUB_BITS  ***/
+/***  buckets per power of two (largest error 1 / 2^SUB_BITS)            ***/
+#define LATENCY_SUB_BITS    5
+#define LATENCY_BUCKETS     ((64 - LATENCY_SUB_BITS + 1) << LATENCY_SUB_BITS)
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Latency histograms of the phases of a turn, in nanoseconds of the
+ *  steady clock. Buckets grow log-linearly as in HDR histograms, so any
+ *  latency from nanoseconds to hours is kept with about 3 % precision
+ *  in constant memory. Recording is a bucket lookup and a few relaxed
+ *  atomic additions, safe from any thread. Histograms are shown on exit
+ *  and exported as JSON or Prometheus text.                          */
+
+class Latency
+{
+    public:
+    /** Types / Structs **/
+        typedef enum {INPUT_TO_INSERT,          // Key queued until token inserted
+                      INSERT_TO_ANIMATED,       // Token inserted until drop shown
+                      ENGINE_THINK,             // Machine move chosen
+                      WIN_CHECK,                // End of game checked
+                      RENDER,                   // Frame written to console
+                      PHASES} PHASE;
+
+    /** Nested class **/
+        class Timer
+        {
+            public:
+            /** Constructor / Destructor **/
+                Timer (PHASE phase);
+                ~Timer();
+
+            private:
+            /** Variables **/
+                PHASE               tPhase;
+                unsigned long long  ullStart;
+        };
+
+    /** Getter / Setter **/
+        static unsigned long long   ullGet_Time         ();
+        static unsigned long long   ullGet_Count        (PHASE phase);
+        static unsigned long long   ullGet_Percentile   (PHASE phase, double percent);
+        static const std::string&   sGet_File           ();
+        static void                 vSet_File           (const std::string& path);
+
+    /** Member functions / methods **/
+        static void         vRecord         (PHASE phase, unsigned long long ns);
+        static void         vShow           (std::ostream& out);
+        static std::string  sGet_Json       ();
+        static std::string  sGet_Prometheus ();
+        static bool         bWrite          (const std::string& path);
+
+    private:
+    /** Types / Structs **/
+        typedef struct
+        {
+            std::atomic<unsigned long long> aBuckets[LATENCY_BUCKETS];
+            std::atomic<unsigned long long> ullCount, ullSum, ullMax;
+        } HISTOGRAM;
+
+    /** Member functions / methods **/
+        static short                siBucket    (unsigned long long ns);
+        static unsigned long long   ullValue    (short bucket);
+
+    /** Variables **/
+        static HISTOGRAM    aHistograms[PHASES];
+        static std::string  sFile;          // Written on exit if set
+};
+
+/*** Recording, inline as it runs in every turn ***/
+inline unsigned long long Latency::ullGet_Time()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds> (
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline short Latency::siBucket (unsigned long long ns)
+{
+    if (ns < (1ULL << LATENCY_SUB_BITS)) return ns;
+
+    short shift = 63 - __builtin_clzll (ns) - LATENCY_SUB_BITS;
+
+    return ((shift + 1) << LATENCY_SUB_BITS) + (short)((ns >> shift) - (1ULL << LATENCY_SUB_BITS));
+}
+
+inline void Latency::vRecord (PHASE phase, unsigned long long ns)
+{
+    HISTOGRAM&         histogram = aHistograms[phase];
+    unsigned long long max       = histogram.ullMax.load (std::memory_order_relaxed);
+
+    histogram.aBuckets[siBucket (ns)].fetch_add (1, std::memory_order_relaxed);
+    histogram.ullCount.fetch_add (1,  std::memory_order_relaxed);
+    histogram.ullSum.fetch_add   (ns, std::memory_order_relaxed);
+
+    while (ns > max && !histogram.ullMax.compare_exchange_weak (max, ns, std::memory_order_relaxed));
+}
+
+inline Latency::Timer::Timer (PHASE phase)
+{
+    tPhase   = phase;
+    ullStart = ullGet_Time();
+}
+
+inline Latency::Timer::~Timer()
+{
+    vRecord (tPhase, ullGet_Time() - ullStart);
+}
+
+#endif // _LATENCY_H_
@@ -0,0 +1,187 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    LineTable.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Winning line tables
+ *           Lines and lines through each cell of all token counts,
+ *           generated by the compiler.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "LineTable.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+#define LINE_FRAME_CELLS    (LINE_FRAME_SLOTS * LINE_FRAME_LINES)
+#define LINE_TOKEN_COUNTS   (LINE_TOKENS_MAX - WIN_TOKENS_MIN + 1)
+
+/*=============================================================================
+=====                           LOCAL FUNCTIONS                           =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   liTotal
+ *
+ *  @brief      Lines or line cells of all token counts
+ *
+ *  @param      cells : true  to count every cell of each line
+ *  @return     Number of lines or line cells
+ ******************************************************************************/
+
+static constexpr long liTotal (bool cells)
+{
+    long total = 0;
+
+    for (short tokens = WIN_TOKENS_MIN; tokens <= LINE_TOKENS_MAX; tokens++)
+        total += LineTable::liCount (tokens) * (cells ? tokens : 1);
+
+    return total;
+}
+
+/*=============================================================================
+=====                          STATIC VARIABLES                           =====
+=============================================================================*/
+
+/*  Tables of all token counts, lines of token count k are
+ *  aLine[aFirst[k] ... aFirst[k + 1] - 1], lines through cell c
+ *  (slot * LINE_FRAME_LINES + line) are aCellLine[aCellFirst[k][c] ...
+ *  aCellFirst[k][c + 1] - 1] as index into the lines of k.            */
+
+struct LINE_TABLES
+{
+    LineTable::LINE aLine      [liTotal (false)];
+    unsigned int    aFirst     [LINE_TOKEN_COUNTS + 1];
+    unsigned int    aCellFirst [LINE_TOKEN_COUNTS][LINE_FRAME_CELLS + 1];
+    unsigned short  aCellLine  [liTotal (true)];
+
+    constexpr LINE_TABLES() : aLine{}, aFirst{}, aCellFirst{}, aCellLine{}
+    {
+        // Steps up, to the right, diagonally up and down to the right
+        const short step[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+
+        unsigned int lines = 0, cells = 0;
+
+        for (short k = 0; k < LINE_TOKEN_COUNTS; k++)
+        {
+            const short tokens = WIN_TOKENS_MIN + k;
+
+            aFirst[k] = lines;
+
+            for (short dir = 0; dir < 4; dir++)
+            {
+                for (short slot = 0; slot < LINE_FRAME_SLOTS; slot++)
+                {
+                    for (short line = 0; line < LINE_FRAME_LINES; line++)
+                    {
+                        const short end_slot = slot + step[dir][0] * (tokens - 1);
+                        const short end_line = line + step[dir][1] * (tokens - 1);
+
+                        if (end_slot >= LINE_FRAME_SLOTS || end_line < 0 || end_line >= LINE_FRAME_LINES) continue;
+
+                        LineTable::LINE& entry = aLine[lines++];
+
+                        entry.slot  = slot;
+                        entry.line  = line;
+                        entry.dir   = dir;
+                        entry.slots = end_slot + 1;
+                        entry.lines = (end_line > line ? end_line : line) + 1;
+
+                        for (short i = 0; i < tokens; i++)
+                        {
+                            const short bit = (slot + step[dir][0] * i) * PACKED_LANE_BITS + line + step[dir][1] * i;
+
+                            entry.cells.word[bit / 64] |= 1ULL << (bit % 64);
+                            aCellFirst[k][(slot + step[dir][0] * i) * LINE_FRAME_LINES + line + step[dir][1] * i + 1]++;
+                        }
+                    }
+                }
+            }
+
+            // Counts to first entries, then fill in order of lines
+            unsigned int next[LINE_FRAME_CELLS] = {};
+
+            aCellFirst[k][0] = cells;
+            for (short cell = 0; cell < LINE_FRAME_CELLS; cell++)
+            {
+                aCellFirst[k][cell + 1] += aCellFirst[k][cell];
+                next[cell] = aCellFirst[k][cell];
+            }
+
+            for (unsigned int index = aFirst[k]; index < lines; index++)
+            {
+                const LineTable::LINE& entry = aLine[index];
+
+                for (short i = 0; i < tokens; i++)
+                {
+                    const short cell = (entry.slot + step[entry.dir][0] * i) * LINE_FRAME_LINES + entry.line + step[entry.dir][1] * i;
+
+                    aCellLine[next[cell]++] = index - aFirst[k];
+                }
+            }
+            cells = aCellFirst[k][LINE_FRAME_CELLS];
+        }
+        aFirst[LINE_TOKEN_COUNTS] = lines;
+    }
+};
+
+static constexpr LINE_TABLES tTables;
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   pGet_Lines
+ *
+ *  @brief      Returns the lines of the frame for a token count,
+ *              liCount (tokens) entries
+ *
+ *  @param      tokens : WIN_TOKENS_MIN ... LINE_TOKENS_MAX
+ *  @return     First line, NULL if token count is out of range
+ ******************************************************************************/
+
+const LineTable::LINE* LineTable::pGet_Lines (short tokens)
+{
+    if (tokens < WIN_TOKENS_MIN || tokens > LINE_TOKENS_MAX) return NULL;
+
+    return &tTables.aLine[tTables.aFirst[tokens - WIN_TOKENS_MIN]];
+}
+
+
+/******************************************************************************
+ *  @function   pGet_CellLines
+ *
+ *  @brief      Returns the lines of the frame through a cell
+ *
+ *  @param      tokens     : WIN_TOKENS_MIN ... LINE_TOKENS_MAX
+ *              slot, line : Cell (indexes, lines from bottom)
+ *              count      : Receives number of lines
+ *  @return     Indexes into pGet_Lines (tokens), NULL if out of range
+ ******************************************************************************/
+
+const unsigned short* LineTable::pGet_CellLines (short tokens, short slot, short line, short& count)
+{
+    count = 0;
+
+    if (tokens < WIN_TOKENS_MIN || tokens > LINE_TOKENS_MAX ||
+        slot < 0 || slot >= LINE_FRAME_SLOTS || line < 0 || line >= LINE_FRAME_LINES) return NULL;
+
+    const unsigned int* first = &tTables.aCellFirst[tokens - WIN_TOKENS_MIN][slot * LINE_FRAME_LINES + line];
+
+    count = first[1] - first[0];
+    return &tTables.aCellLine[first[0]];
+}
@@ -0,0 +1,91 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    LineTable.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   LineTable
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _LINETABLE_H_
+#define _LINETABLE_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  Module header includes  -------*/
+#include "GameState.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Largest board all winning lines are laid out on  ***/
+#define LINE_FRAME_SLOTS    BOARD_SLOTS_MAX
+#define LINE_FRAME_LINES    BOARD_LINES_MAX
+#define LINE_TOKENS_MAX     (BOARD_SLOTS_MAX < BOARD_LINES_MAX ? BOARD_SLOTS_MAX : BOARD_LINES_MAX)
+
+/***  Directions of lines  ***/
+#define LINE_UP             0
+#define LINE_RIGHT          1
+#define LINE_RIGHT_UP       2
+#define LINE_RIGHT_DOWN     3
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Winning lines of all board configurations, generated at compile time
+ *  into read-only data. A line of a board with fewer slots or lines is
+ *  the same line of the largest board (frame), so one table per token
+ *  count covers all board sizes: a board takes the lines fitting into
+ *  it. Cells of a line are set in the lanes of GameState::PACKED (one
+ *  16 bit lane per slot, lines from bottom). Lines through a cell are
+ *  listed per token count for incremental updates.                    */
+
+class LineTable
+{
+    public:
+    /** Types / Structs **/
+        typedef struct
+        {
+            GameState::PACKED   cells;          // Lanes of GameState::PACKED
+            unsigned char       slot, line;     // First cell (indexes, lines from bottom)
+            unsigned char       dir;            // LINE_UP ... LINE_RIGHT_DOWN
+            unsigned char       slots, lines;   // Smallest board holding the line
+        } LINE;
+
+    /** Getter **/
+        static const LINE*              pGet_Lines      (short tokens);
+        static const unsigned short*    pGet_CellLines  (short tokens, short slot, short line, short& count);
+
+    /** Member functions / methods **/
+        static bool     bFits           (const LINE& line, short slots, short lines);
+
+        /*** Lines of the frame for a token count, zero if out of range ***/
+        static constexpr long liCount (short tokens)
+        {
+            return tokens < WIN_TOKENS_MIN || tokens > LINE_TOKENS_MAX ? 0 :
+                   (long)(LINE_FRAME_SLOTS - tokens + 1) * LINE_FRAME_LINES +           // Right
+                   (long)LINE_FRAME_SLOTS * (LINE_FRAME_LINES - tokens + 1) +           // Up
+                   2L * (LINE_FRAME_SLOTS - tokens + 1) * (LINE_FRAME_LINES - tokens + 1); // Diagonal
+        }
+};
+
+/*** Lines of a board: frame lines fitting into it ***/
+inline bool LineTable::bFits (const LINE& line, short slots, short lines)
+{
+    return line.slots <= slots && line.lines <= lines;
+}
+
+#endif // _LINETABLE_H_
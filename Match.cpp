@@ -0,0 +1,304 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Match.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Match interface
+ *           Provides the game flow of a single game as resumable state
+ *           machine without blocking calls and console dependencies.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "Match.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class Match
+ *
+ *  @brief      * Instantiates a Match object
+ *              * Both players are machine players on a default game board
+ *              * No game is running until a match is assigned
+ *  @param      -
+ ******************************************************************************/
+
+Match::Match()
+{
+    DEBUG_CONSTRUCTOR;
+
+    bMachine[0] = true;
+    bMachine[1] = true;
+    bAnimation  = false;
+
+    tPhase      = FINISHED;
+    siWinner    = 0;
+    siLastSlot  = 0;  siLastPlayer = 0;  siFramesLeft = 0;
+}
+
+
+/******************************************************************************
+ *  @function   Overloaded Constructor of class Match
+ *
+ *  @brief      * Instantiates a Match object
+ *              * Continues the game from the given game state
+ *
+ *  @param      _oGameState  : Rules and position to play from
+ *              _bMachine_P1 : true if player 1 is a machine player
+ *              _bMachine_P2 : true if player 2 is a machine player
+ ******************************************************************************/
+
+Match::Match (const GameState& _oGameState, bool _bMachine_P1, bool _bMachine_P2)
+{
+    DEBUG_CONSTRUCTOR;
+    TRACE_EVENT ("game", "game start");
+
+    oGameState  = _oGameState;
+    bMachine[0] = _bMachine_P1;
+    bMachine[1] = _bMachine_P2;
+    bAnimation  = false;
+
+    siLastSlot  = 0;  siLastPlayer = 0;  siFramesLeft = 0;
+
+    vNext_Turn();
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class Match
+ *
+ *  @brief      Destroys this Match object
+ ******************************************************************************/
+
+Match::~Match()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Phase
+ *
+ *  @brief      Returns what the match is waiting for
+ *  @param      -
+ *  @return     tPhase : AWAIT_HUMAN || AWAIT_MACHINE || AWAIT_FRAME || FINISHED
+ ******************************************************************************/
+
+Match::PHASE Match::tGet_Phase() const
+{
+    return tPhase;
+}
+
+
+/******************************************************************************
+ *  @function   oGet_GameState
+ *
+ *  @brief      Returns current game state of the match
+ *  @param      -
+ *  @return     oGameState : Rules, position, side to move and history
+ ******************************************************************************/
+
+const GameState& Match::oGet_GameState() const
+{
+    return oGameState;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Winner
+ *
+ *  @brief      Returns winner of the match
+ *  @param      -
+ *  @return     WON_HUMAN || WON_MACHINE : ID of player that won the game
+ *              Zero if no player won (yet)
+ ******************************************************************************/
+
+short Match::siGet_Winner() const
+{
+    return siWinner;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_LastSlot
+ *
+ *  @brief      Returns slot of the last move
+ *  @param      -
+ *  @return     siLastSlot : Slot number (1 ... slots), zero if no move yet
+ ******************************************************************************/
+
+short Match::siGet_LastSlot() const
+{
+    return siLastSlot;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_LastPlayer
+ *
+ *  @brief      Returns player of the last move
+ *  @param      -
+ *  @return     siLastPlayer : PLAYER_1_ID || PLAYER_2_ID, zero if no move yet
+ ******************************************************************************/
+
+short Match::siGet_LastPlayer() const
+{
+    return siLastPlayer;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_FramesLeft
+ *
+ *  @brief      Returns number of animation frames until the dropped
+ *              token reached its field
+ *  @param      -
+ *  @return     siFramesLeft : Number of outstanding animation frames
+ ******************************************************************************/
+
+short Match::siGet_FramesLeft() const
+{
+    return siFramesLeft;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Animation
+ *
+ *  @brief      Enables or disables waiting for animation frames after a move
+ *
+ *  @param      _bAnimation : true   match waits for one frame per line
+ *                                   the token is falling
+ *                            false  next turn starts immediately
+ *  @return     -
+ ******************************************************************************/
+
+void Match::vSet_Animation (bool _bAnimation)
+{
+    bAnimation = _bAnimation;
+}
+
+
+/******************************************************************************
+ *  @function   vRestart
+ *
+ *  @brief      Restarts the match with an empty board and same rules
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void Match::vRestart()
+{
+    TRACE_EVENT ("game", "game start");
+
+    oGameState.vReset();
+
+    siLastSlot  = 0;  siLastPlayer = 0;  siFramesLeft = 0;
+
+    vNext_Turn();
+}
+
+
+/******************************************************************************
+ *  @function   bSupply_Move
+ *
+ *  @brief      Plays the move of the player the match is waiting for
+ *
+ *  @param      slot : Slot number (1 ... slots)
+ *  @return     bool : true   if move was played
+ *                     false  if no move is expected or slot is full
+ ******************************************************************************/
+
+bool Match::bSupply_Move (short slot)
+{
+    if (tPhase != AWAIT_HUMAN && tPhase != AWAIT_MACHINE) return false;
+
+    TRACE_EVENT ("game", "move");
+
+    short player = oGameState.siGet_CurrentPlayer();
+
+    if (!oGameState.bPlay_Move (slot)) return false;
+
+    siLastPlayer = player;
+    siLastSlot   = slot;
+
+    // Token falls from above the board down to its field
+    if (bAnimation)
+    {
+        siFramesLeft = oGameState.tGet_BoardSize().line -
+                       oGameState.siGet_SlotHeight (slot) + 1;
+        tPhase       = AWAIT_FRAME;
+    }
+    else vNext_Turn();
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   vSupply_Frame
+ *
+ *  @brief      Advances token drop animation by one frame.
+ *              Next turn starts after the last frame.
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void Match::vSupply_Frame()
+{
+    if (tPhase != AWAIT_FRAME) return;
+
+    if (--siFramesLeft <= 0) vNext_Turn();
+}
+
+
+/******************************************************************************
+ *  @function   vSkip_Frames
+ *
+ *  @brief      Completes token drop animation immediately
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void Match::vSkip_Frames()
+{
+    if (tPhase != AWAIT_FRAME) return;
+
+    siFramesLeft = 0;
+    vNext_Turn();
+}
+
+
+/******************************************************************************
+ *  @function   vNext_Turn
+ *
+ *  @brief      Checks for end of game, otherwise waits for the move of
+ *              the player to move
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void Match::vNext_Turn()
+{
+    {
+        Latency::Timer oCheck (Latency::WIN_CHECK);
+        siWinner = oGameState.siCheck_WinState();
+    }
+
+    if   (siWinner > 0 || oGameState.siGet_FreeFields() == 0)
+         tPhase = FINISHED;
+    else tPhase = bMachine[oGameState.siGet_CurrentPlayer() - 1] ? AWAIT_MACHINE
+                                                                 : AWAIT_HUMAN;
+}
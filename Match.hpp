@@ -0,0 +1,80 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Match.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   Match
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _MATCH_H_
+#define _MATCH_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  Module header includes  -------*/
+#include "GameState.hpp"
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Resumable game flow of a single game. A match never blocks: it
+ *  reports what it is waiting for (human move, machine move or
+ *  animation frame) and advances when the driver supplies it.
+ *  One thread can therefore interleave any number of matches.         */
+
+class Match
+{
+    public:
+    /** Types / Structs **/
+        typedef enum {AWAIT_HUMAN, AWAIT_MACHINE,
+                      AWAIT_FRAME, FINISHED} PHASE;
+
+    /** Constructor / Destructor **/
+        Match ();
+        Match (const GameState& _oGameState, bool _bMachine_P1, bool _bMachine_P2);
+        ~Match ();
+
+    /** Getter / Setter **/
+        PHASE               tGet_Phase          () const;
+        const GameState&    oGet_GameState      () const;
+        short               siGet_Winner        () const;
+        short               siGet_LastSlot      () const;
+        short               siGet_LastPlayer    () const;
+        short               siGet_FramesLeft    () const;
+
+        void                vSet_Animation      (bool _bAnimation);
+
+    /** Further Member functions / methods **/
+        void                vRestart            ();
+        bool                bSupply_Move        (short slot);
+        void                vSupply_Frame       ();
+        void                vSkip_Frames        ();
+
+    private:
+    /** Variables **/
+        GameState   oGameState;
+        PHASE       tPhase;
+        short       siWinner;
+        short       siLastSlot, siLastPlayer;
+        short       siFramesLeft;
+        bool        bMachine[2];
+        bool        bAnimation;
+
+    /** Member functions / methods **/
+        void                vNext_Turn          ();
+};
+
+#endif // _MATCH_H_
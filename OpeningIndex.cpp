@@ -0,0 +1,563 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    OpeningIndex.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Opening explorer index
+ *           Builds a sorted position index from game record files with
+ *           an external sort and answers "how did games from this
+ *           position turn out" with a few page accesses.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::sort, std::lower_bound
+#include <cstdio>       // std::remove
+#include <cstring>      // std::memcpy, std::memcmp
+#include <fstream>
+#include <iomanip>      // std::setw, std::setprecision
+#include <queue>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "OpeningIndex.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Entries read at once from a sorted run  ***/
+#define RUN_READ_ENTRIES    65536
+
+/*=============================================================================
+=====                           LOCAL FUNCTIONS                           =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   ullMix
+ *
+ *  @brief      Hash mixing function (splitmix64)
+ *
+ *  @param      value : Input
+ *  @return     Pseudo random 64 bit value of input
+ ******************************************************************************/
+
+static unsigned long long ullMix (unsigned long long value)
+{
+    value += 0x9E3779B97F4A7C15ULL;
+    value  = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value  = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+    return value ^ (value >> 31);
+}
+
+
+/******************************************************************************
+ *  @function   bEntry_Less
+ *
+ *  @brief      Sort order of index entries: position, then next move
+ *
+ *  @param      a, b : Index entries
+ *  @return     bool : true  if a is sorted before b
+ ******************************************************************************/
+
+static bool bEntry_Less (const OpeningIndex::INDEX_ENTRY& a, const OpeningIndex::INDEX_ENTRY& b)
+{
+    return a.hash < b.hash || (a.hash == b.hash && a.slot < b.slot);
+}
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class OpeningIndex
+ *
+ *  @brief      Instantiates an OpeningIndex object without index file
+ *  @param      -
+ ******************************************************************************/
+
+OpeningIndex::OpeningIndex()
+{
+    DEBUG_CONSTRUCTOR;
+
+    pHeader  = NULL;
+    pPages   = NULL;
+    pFences  = NULL;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class OpeningIndex
+ *
+ *  @brief      Destroys this OpeningIndex object
+ ******************************************************************************/
+
+OpeningIndex::~OpeningIndex()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   bBuild
+ *
+ *  @brief      Builds an index file from game record files
+ *              * Every finished game is replayed, each position (up to
+ *                max_plies) is collected with its next move and result
+ *              * When memory is full, positions are sorted, counted and
+ *                written as sorted run file
+ *              * All runs are merged into the index file
+ *
+ *  @param      archives  : Game record files
+ *              index     : Index file to be written
+ *              max_plies : Positions after more moves are not indexed
+ *  @return     bool      : false  if a file can not be read or written
+ ******************************************************************************/
+
+bool OpeningIndex::bBuild (const std::vector<std::string>& archives, const std::string& index,
+                           short max_plies)
+{
+    RecordFile                      oArchive;
+    std::vector<RecordFile::SPAN>   vecBlocks;
+    std::vector<POSITION>           vecPositions;
+    std::vector<std::string>        vecRuns;
+    GameRecord                      oRecord;
+    bool                            ok = true;
+
+    vecPositions.reserve (INDEX_BUILD_MEMORY / sizeof(POSITION));
+
+    for (const std::string& archive : archives)
+    {
+        if (!oArchive.bOpen (archive)) {ok = false;  continue;}
+        oArchive.bIndex_Blocks (vecBlocks);     // Corrupt tail is skipped
+
+        for (const RecordFile::SPAN& block : vecBlocks)
+        {
+            const unsigned char* pos = block.begin;
+            size_t               used;
+
+            while (pos < block.end && (used = oRecord.tDecode (pos, block.end - pos)) > 0)
+            {
+                pos += used;
+                if (oRecord.siGet_Winner() == RECORD_UNFINISHED) continue;
+
+                GameState oGameState;
+
+                oGameState.vSet_BoardSize   (oRecord.tGet_BoardSize());
+                oGameState.vSet_WinTokens   (oRecord.siGet_WinTokens());
+                oGameState.vSet_StartPlayer (oRecord.siGet_StartPlayer());
+
+                short slots = oGameState.tGet_BoardSize().slot;
+
+                for (short i = 0; i < oRecord.siGet_MoveCount() && i < max_plies; i++)
+                {
+                    ORIENTATION        orient;
+                    unsigned long long hash = ullHash (oGameState, &orient);
+                    short              slot = oRecord.siGet_Move (i);
+
+                    vecPositions.push_back ({hash, (unsigned char)siEntry_Slot (slot, slots, orient),
+                                             (unsigned char)oRecord.siGet_Winner()});
+
+                    oGameState.bPlay_Move (slot);
+                }
+
+                if (vecPositions.size() + BOARD_FIELDS_MAX > vecPositions.capacity())
+                {
+                    vecRuns.push_back (index + ".run" + std::to_string (vecRuns.size()));
+                    ok = ok && bWrite_Run (vecPositions, vecRuns.back());
+                }
+            }
+        }
+    }
+
+    if (!vecPositions.empty())
+    {
+        vecRuns.push_back (index + ".run" + std::to_string (vecRuns.size()));
+        ok = ok && bWrite_Run (vecPositions, vecRuns.back());
+    }
+
+    ok = ok && bMerge_Runs (vecRuns, index);
+
+    for (const std::string& run : vecRuns)  std::remove (run.c_str());
+
+    return ok;
+}
+
+
+/******************************************************************************
+ *  @function   bOpen
+ *
+ *  @brief      Maps an index file for queries
+ *
+ *  @param      index : Index file
+ *  @return     bool  : false  if file can not be mapped or is no index
+ ******************************************************************************/
+
+bool OpeningIndex::bOpen (const std::string& index)
+{
+    pHeader = NULL;  pPages = NULL;  pFences = NULL;
+
+    if (!oIndexFile.bOpen (index, false) || oIndexFile.tGet_Size() < INDEX_PAGE_SIZE) return false;
+
+    const unsigned char*  data   = oIndexFile.pGet_Data();
+    const INDEX_HEADER*   header = (const INDEX_HEADER*)data;
+
+    if (std::memcmp (header->magic, INDEX_MAGIC, 4) != 0  ||
+        header->version != INDEX_VERSION  ||
+        header->fence_offset + header->pages * sizeof(unsigned long long) > oIndexFile.tGet_Size())
+        return false;
+
+    pHeader  = header;
+    pPages   = data + INDEX_PAGE_SIZE;
+    pFences  = (const unsigned long long*)(data + header->fence_offset);
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   bQuery
+ *
+ *  @brief      Looks up results of all games which passed a position
+ *              or its mirror image. Fences give the page of the position
+ *              by binary search, its entries are read from this page on
+ *              (one or two pages). Moves of symmetric positions are given
+ *              for the left one of two equivalent slots.
+ *
+ *  @param      _oGameState : Position
+ *              stats       : Receives results for side to move and per
+ *                            next move, best continuation
+ *  @return     bool        : false  if position is not in the index
+ ******************************************************************************/
+
+bool OpeningIndex::bQuery (const GameState& _oGameState, POSITION_STATS& stats) const
+{
+    ORIENTATION        orient;
+    unsigned long long hash   = ullHash (_oGameState, &orient);
+    short              slots  = _oGameState.tGet_BoardSize().slot;
+    bool               p1     = _oGameState.siGet_CurrentPlayer() == PLAYER_1_ID;
+    double             best   = -1;
+
+    stats = POSITION_STATS {0, 0, 0, 0, 0, {}};
+
+    if (pHeader == NULL || pHeader->pages == 0) return false;
+
+    // Position may begin on the page before the first page with a larger fence
+    size_t page = std::lower_bound (pFences, pFences + pHeader->pages, hash) - pFences;
+    if (page > 0) page--;
+
+    for (size_t i = page * INDEX_PAGE_ENTRIES; i < pHeader->entries && tEntry (i).hash <= hash; i++)
+    {
+        const INDEX_ENTRY& entry = tEntry (i);
+
+        if (entry.hash != hash) continue;
+
+        MOVE_STATS move;
+
+        move.slot   = siEntry_Slot (entry.slot, slots, orient);     // Mapping is its own inverse
+        move.wins   = p1 ? entry.wins_p1 : entry.wins_p2;
+        move.losses = p1 ? entry.wins_p2 : entry.wins_p1;
+        move.draws  = entry.draws;
+        move.games  = move.wins + move.draws + move.losses;
+
+        stats.games  += move.games;   stats.wins   += move.wins;
+        stats.draws  += move.draws;   stats.losses += move.losses;
+        stats.moves.push_back (move);
+
+        // Best continuation: highest score for side to move
+        double score = (move.wins + 0.5 * move.draws) / move.games;
+
+        if (score > best) {best = score;  stats.best_slot = move.slot;}
+    }
+
+    std::sort (stats.moves.begin(), stats.moves.end(), [](const MOVE_STATS& a, const MOVE_STATS& b)
+    {
+        return a.slot < b.slot;
+    });
+    return stats.games > 0;
+}
+
+
+/******************************************************************************
+ *  @function   vShow_Query
+ *
+ *  @brief      Prints results of a position and of all its continuations
+ *
+ *  @param      _oGameState : Position
+ *  @return     -
+ ******************************************************************************/
+
+void OpeningIndex::vShow_Query (const GameState& _oGameState) const
+{
+    POSITION_STATS stats;
+
+    if (!bQuery (_oGameState, stats))
+    {
+        std::cout << "  Position not in index\n";
+        return;
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "  Games                : " << stats.games << "\n"
+              << "  Side to move won     : " << 100.0 * stats.wins   / stats.games << " %\n"
+              << "  Tie                  : " << 100.0 * stats.draws  / stats.games << " %\n"
+              << "  Side to move lost    : " << 100.0 * stats.losses / stats.games << " %\n"
+              << "  Best continuation    : " << stats.best_slot << "\n"
+              << "  Slot     Games       Won      Tie     Lost\n";
+
+    for (const MOVE_STATS& move : stats.moves)
+    {
+        std::cout << "  " << std::setw(4) << move.slot << std::setw(10) << move.games
+                  << std::setw(10) << 100.0 * move.wins   / move.games << " %"
+                  << std::setw(7)  << 100.0 * move.draws  / move.games << " %"
+                  << std::setw(7)  << 100.0 * move.losses / move.games << " %\n";
+    }
+}
+
+
+/******************************************************************************
+ *  @function   ullHash
+ *
+ *  @brief      Hash of a position: rules, side to move and the canonical
+ *              board, so a position and its mirror image share entries
+ *
+ *  @param      _oGameState : Position
+ *              orientation : Receives how slots of the position map to
+ *                            slots of the entries
+ *  @return     Position hash
+ ******************************************************************************/
+
+unsigned long long OpeningIndex::ullHash (const GameState& _oGameState, ORIENTATION* orientation)
+{
+    GameState::BOARD  size   = _oGameState.tGet_BoardSize();
+    GameState::PACKED packed = _oGameState.tGet_Packed();
+    GameState::PACKED mirror = GameState::tMirror (packed, size.slot);
+
+    unsigned long long hash = ullMix (0xC4ULL << 32 | _oGameState.siGet_CurrentPlayer() << 24 |
+                                      size.slot << 16 | size.line << 8 | _oGameState.siGet_WinTokens());
+
+    ORIENTATION orient = GameState::bPacked_Less (mirror, packed) ? MIRRORED :
+                         GameState::bPacked_Less (packed, mirror) ? AS_IS    : SYMMETRIC;
+
+    if (orientation != NULL) *orientation = orient;
+
+    for (unsigned long long word : (orient == MIRRORED ? mirror : packed).word)
+        hash = ullMix (hash ^ word);
+
+    return hash;
+}
+
+
+/******************************************************************************
+ *  @function   siEntry_Slot
+ *
+ *  @brief      Maps a slot of a position to the slot of its entry:
+ *              mirrored for mirrored positions, for symmetric positions
+ *              both equivalent slots map to the left one
+ *
+ *  @param      slot        : Slot number (1 ... slots)
+ *              slots       : Number of slots of board
+ *              orientation : Orientation of position
+ *  @return     Slot number of entry
+ ******************************************************************************/
+
+short OpeningIndex::siEntry_Slot (short slot, short slots, ORIENTATION orientation)
+{
+    short mirror = slots + 1 - slot;
+
+    return orientation == MIRRORED  ? mirror :
+           orientation == SYMMETRIC ? std::min (slot, mirror) : slot;
+}
+
+
+/******************************************************************************
+ *  @function   tEntry
+ *
+ *  @brief      Returns an entry of the mapped index
+ *
+ *  @param      nth_entry : Entry number (0 ... entries - 1)
+ *  @return     Entry within its page
+ ******************************************************************************/
+
+const OpeningIndex::INDEX_ENTRY& OpeningIndex::tEntry (unsigned long long nth_entry) const
+{
+    const unsigned char* page = pPages + nth_entry / INDEX_PAGE_ENTRIES * INDEX_PAGE_SIZE;
+
+    return ((const INDEX_ENTRY*)page)[nth_entry % INDEX_PAGE_ENTRIES];
+}
+
+
+/******************************************************************************
+ *  @function   bWrite_Run
+ *
+ *  @brief      Sorts collected positions, counts equal (position, move)
+ *              and writes them as sorted run file
+ *
+ *  @param      positions : Collected positions, empty afterwards
+ *              path      : Run file
+ *  @return     bool      : false  if file can not be written
+ ******************************************************************************/
+
+bool OpeningIndex::bWrite_Run (std::vector<POSITION>& positions, const std::string& path)
+{
+    std::ofstream oRun (path, std::ios::binary | std::ios::trunc);
+    INDEX_ENTRY   entry = {};
+
+    std::sort (positions.begin(), positions.end(), [](const POSITION& a, const POSITION& b)
+    {
+        return a.hash < b.hash || (a.hash == b.hash && a.slot < b.slot);
+    });
+
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        const POSITION& pos = positions[i];
+
+        if (i == 0 || pos.hash != entry.hash || pos.slot != entry.slot)
+        {
+            if (i > 0) oRun.write ((const char*)&entry, sizeof(entry));
+            entry = {pos.hash, 0, 0, 0, pos.slot, {0}};
+        }
+        if      (pos.winner == PLAYER_1_ID) entry.wins_p1++;
+        else if (pos.winner == PLAYER_2_ID) entry.wins_p2++;
+        else                                entry.draws++;
+    }
+    if (!positions.empty()) oRun.write ((const char*)&entry, sizeof(entry));
+
+    positions.clear();
+
+    return oRun.good();
+}
+
+
+/******************************************************************************
+ *  @function   bMerge_Runs
+ *
+ *  @brief      Merges sorted runs into the index file (k-way merge).
+ *              Equal (position, move) of different runs are added up.
+ *              Entries are written page by page, the first hash of each
+ *              page is kept as fence.
+ *
+ *  @param      runs  : Sorted run files
+ *              index : Index file
+ *  @return     bool  : false  if a file can not be read or written
+ ******************************************************************************/
+
+bool OpeningIndex::bMerge_Runs (const std::vector<std::string>& runs, const std::string& index)
+{
+    typedef struct
+    {
+        std::ifstream               in;
+        std::vector<INDEX_ENTRY>    buf;
+        size_t                      pos, len;
+    } RUN;
+
+    std::vector<RUN>                vecRun (runs.size());
+    std::vector<unsigned long long> vecFences;
+    std::vector<INDEX_ENTRY>        vecPage;
+    std::ofstream                   oIndex (index, std::ios::binary | std::ios::trunc);
+    INDEX_HEADER                    header = {};
+    INDEX_ENTRY                     entry  = {};
+    bool                            first  = true;
+
+    // Reads next entry of a run, refills its buffer when empty
+    auto bNext = [](RUN& run, INDEX_ENTRY& out) -> bool
+    {
+        if (run.pos == run.len)
+        {
+            run.in.read ((char*)run.buf.data(), run.buf.size() * sizeof(INDEX_ENTRY));
+            run.len = run.in.gcount() / sizeof(INDEX_ENTRY);
+            run.pos = 0;
+            if (run.len == 0) return false;
+        }
+        out = run.buf[run.pos++];
+        return true;
+    };
+
+    // Writes an entry, full pages are written to the file
+    auto vPut = [&](const INDEX_ENTRY& out)
+    {
+        if (vecPage.empty()) vecFences.push_back (out.hash);
+        vecPage.push_back (out);
+
+        if (vecPage.size() == INDEX_PAGE_ENTRIES)
+        {
+            vecPage.resize (INDEX_PAGE_SIZE / sizeof(INDEX_ENTRY) + 1);     // Pad page
+            oIndex.write ((const char*)vecPage.data(), INDEX_PAGE_SIZE);
+            vecPage.clear();
+        }
+        header.entries++;
+    };
+
+    // Page 0 is the header, written at the end
+    std::vector<char> zero (INDEX_PAGE_SIZE, 0);
+    oIndex.write (zero.data(), INDEX_PAGE_SIZE);
+    vecPage.reserve (INDEX_PAGE_ENTRIES + 1);
+
+    // Queue holds the next entry of each run, smallest first
+    auto later = [](const std::pair<INDEX_ENTRY, size_t>& a, const std::pair<INDEX_ENTRY, size_t>& b)
+    {
+        return bEntry_Less (b.first, a.first);
+    };
+    std::priority_queue<std::pair<INDEX_ENTRY, size_t>,
+                        std::vector<std::pair<INDEX_ENTRY, size_t>>, decltype(later)> queue (later);
+
+    for (size_t r = 0; r < runs.size(); r++)
+    {
+        INDEX_ENTRY next;
+
+        vecRun[r].in.open (runs[r], std::ios::binary);
+        vecRun[r].buf.resize (RUN_READ_ENTRIES);
+        vecRun[r].pos = vecRun[r].len = 0;
+
+        if (!vecRun[r].in.is_open()) return false;
+        if (bNext (vecRun[r], next)) queue.push ({next, r});
+    }
+
+    while (!queue.empty())
+    {
+        INDEX_ENTRY next = queue.top().first;
+        size_t      r    = queue.top().second;
+
+        queue.pop();
+
+        if (!first && next.hash == entry.hash && next.slot == entry.slot)
+        {
+            entry.wins_p1 += next.wins_p1;  entry.draws += next.draws;  entry.wins_p2 += next.wins_p2;
+        }
+        else
+        {
+            if (!first) vPut (entry);
+            entry = next;  first = false;
+        }
+        if (bNext (vecRun[r], next)) queue.push ({next, r});
+    }
+    if (!first) vPut (entry);
+
+    // Last page is padded to full size, fences follow the pages
+    if (!vecPage.empty())
+    {
+        vecPage.resize (INDEX_PAGE_SIZE / sizeof(INDEX_ENTRY) + 1);
+        oIndex.write ((const char*)vecPage.data(), INDEX_PAGE_SIZE);
+    }
+
+    std::memcpy (header.magic, INDEX_MAGIC, 4);
+    header.version      = INDEX_VERSION;
+    header.pages        = vecFences.size();
+    header.fence_offset = (header.pages + 1) * INDEX_PAGE_SIZE;
+
+    oIndex.write ((const char*)vecFences.data(), vecFences.size() * sizeof(unsigned long long));
+    oIndex.seekp (0);
+    oIndex.write ((const char*)&header, sizeof(header));
+
+    return oIndex.good();
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    OpeningIndex.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   OpeningIndex
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _OPENINGINDEX_H_
+#define _OPENINGINDEX_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*------  Module header includes  -------*/
+#include "RecordFile.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Index file layout  ***
+ *
+ *  Page 0      : INDEX_HEADER
+ *  Page 1 ...  : INDEX_ENTRY sorted by (hash, slot), INDEX_PAGE_ENTRIES
+ *                per page, last page partly filled
+ *  Fences      : Hash of first entry of each entry page
+ *  All values in host byte order (little endian).
+ */
+#define INDEX_MAGIC             "CF4I"
+#define INDEX_VERSION           3
+#define INDEX_PAGE_SIZE         4096
+#define INDEX_PAGE_ENTRIES      (INDEX_PAGE_SIZE / sizeof(OpeningIndex::INDEX_ENTRY))
+
+/***  Memory for positions collected before a sorted run is written  ***/
+#define INDEX_BUILD_MEMORY      (256L * 1024 * 1024)
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Opening explorer: maps positions (hash of rules, side to move and
+ *  canonical board) to results of the games which passed them, per next move.
+ *  The index is built from record files by an external sort, so it
+ *  can be larger than memory, and is queried through a read-only
+ *  mapping with a binary search over the page fences.                 */
+
+class OpeningIndex
+{
+    public:
+    /** Types / Structs **/
+        typedef struct
+        {
+            unsigned long long  hash;           // Position
+            unsigned long long  wins_p1;        // Games won by player 1,
+            unsigned long long  draws;          // tie games,
+            unsigned long long  wins_p2;        // won by player 2 (64 bit,
+                                                // root sums all games)
+            unsigned char       slot;           // Next move (1 ... slots)
+            unsigned char       reserved[7];
+        } INDEX_ENTRY;
+
+        typedef struct
+        {
+            char                magic[4];
+            unsigned int        version;
+            unsigned long long  entries;
+            unsigned long long  pages;          // Entry pages
+            unsigned long long  fence_offset;   // File offset of fences
+        } INDEX_HEADER;
+
+        typedef struct {short slot; long long games, wins, draws, losses;} MOVE_STATS;
+
+        typedef struct
+        {
+            long long               games, wins, draws, losses;  // Side to move
+            short                   best_slot;                    // 0 if unknown
+            std::vector<MOVE_STATS> moves;
+        } POSITION_STATS;
+
+    /** Constructor / Destructor **/
+                 OpeningIndex();
+        virtual ~OpeningIndex();
+
+    /** Member functions / methods **/
+        virtual bool    bBuild          (const std::vector<std::string>& archives,
+                                         const std::string& index, short max_plies);
+        virtual bool    bOpen           (const std::string& index);
+        virtual bool    bQuery          (const GameState& _oGameState, POSITION_STATS& stats) const;
+        virtual void    vShow_Query     (const GameState& _oGameState) const;
+
+
+    private:
+    /** Types / Structs **/
+        typedef enum {AS_IS, MIRRORED, SYMMETRIC} ORIENTATION;    // Of position to its entries
+        typedef struct {unsigned long long hash; unsigned char slot; unsigned char winner;} POSITION;
+
+    /** Variables **/
+        RecordFile          oIndexFile;
+        const INDEX_HEADER* pHeader;
+        const unsigned char* pPages;        // Entry pages
+        const unsigned long long* pFences;
+
+    /** Member functions / methods **/
+        const INDEX_ENTRY& tEntry (unsigned long long nth_entry) const;
+        bool    bWrite_Run      (std::vector<POSITION>& positions, const std::string& path);
+        bool    bMerge_Runs     (const std::vector<std::string>& runs, const std::string& index);
+
+        static unsigned long long ullHash      (const GameState& _oGameState, ORIENTATION* orientation);
+        static short              siEntry_Slot (short slot, short slots, ORIENTATION orientation);
+};
+
+#endif // _OPENINGINDEX_H_
@@ -20,6 +20,8 @@
 /*------  Module includes  -------*/
 #include "main.hpp"
 #include "Player.hpp"
+#include "GameState.hpp"
+#include "Tablebase.hpp"
 
 /*=============================================================================
 =====                         FUNCTIONS / METHODS                         =====
@@ -35,6 +37,9 @@
 Player::Player()
 {
     DEBUG_CONSTRUCTOR;
+
+    pTable        = NULL;
+    iTable_Config = -1;
 }
 
 /******************************************************************************
@@ -51,6 +56,9 @@ Player::Player (short player_id, bool start_player)
 {
     DEBUG_CONSTRUCTOR;
 
+    pTable        = NULL;
+    iTable_Config = -1;
+
     vSet_CurrentPlayer(start_player);
 }
 
@@ -96,16 +104,65 @@ bool Player::bIs_CurrentPlayer()
 }
 
 
+/******************************************************************************
+ *  @function   uiGet_Seed
+ *
+ *  @brief      Returns seed of the random numbers of machine moves
+ *  @param      -
+ *  @return     Seed of random number sequence
+ ******************************************************************************/
+
+unsigned int Player::uiGet_Seed()
+{
+    return oRandomNr.uiGet_Seed();
+}
+
+
+/******************************************************************************
+ *  @function   siMachine_Move
+ *
+ *  @brief      Selects the slot for the machine players next move:
+ *              a best move if a tablebase covers the game, else random
+ *
+ *  @param      _oGameState : Game state the move is requested for
+ *  @return     Slot number (1 ... slots) of a free slot
+ ******************************************************************************/
+
+short Player::siMachine_Move (const GameState& _oGameState)
+{
+    TRACE_SPAN ("game", "machine move");
+
+    GameState::BOARD size   = _oGameState.tGet_BoardSize();
+    int              config = size.slot << 16 | size.line << 8 | _oGameState.siGet_WinTokens();
+    short            best[BOARD_SLOTS_MAX];
+    short            count;
+
+    if (config != iTable_Config) {pTable = Tablebase::pFind (_oGameState);  iTable_Config = config;}
+
+    // Perfect play, random choice between equally good moves
+    if (pTable != NULL && (count = pTable->siGet_BestMoves (_oGameState, best)) > 0)
+        return best[oRandomNr.iRndNum (1, count) - 1];
+
+    // Generate a random slot out of the free slots
+    short slot = oRandomNr.iRndNum (1, _oGameState.siGet_FreeSlots());
+
+    return _oGameState.siGet_FreeSlotNr (slot);
+}
+
+
 /******************************************************************************
  *  @function   Constructor of nested class RandomNr
  *
  *  @brief      * Instantiates a RandomNr object
+ *              * Seeds random generator with current time
  *  @param      -
  ******************************************************************************/
 
 Player::RandomNr::RandomNr ()
 {
     DEBUG_CONSTRUCTOR;
+
+    vSet_Seed (time(NULL));
 }
 
 
@@ -121,10 +178,42 @@ Player::RandomNr::~RandomNr ()
 }
 
 
+/******************************************************************************
+ *  @function   vSet_Seed
+ *
+ *  @brief      Restarts random number sequence with a new seed
+ *
+ *  @param      _uiSeed : Seed of random number sequence
+ *  @return     -
+ ******************************************************************************/
+
+void Player::RandomNr::vSet_Seed (unsigned int _uiSeed)
+{
+    uiSeed = _uiSeed;
+    oEngine.seed (uiSeed);
+}
+
+
+/******************************************************************************
+ *  @function   uiGet_Seed
+ *
+ *  @brief      Returns seed of current random number sequence
+ *  @param      -
+ *  @return     uiSeed : Seed of random number sequence
+ ******************************************************************************/
+
+unsigned int Player::RandomNr::uiGet_Seed ()
+{
+    return uiSeed;
+}
+
+
 /******************************************************************************
  *  @function   iRndNum
  *
- *  @brief      Generates a time based random number
+ *  @brief      Generates a random number out of the seeded sequence.
+ *              Seeding once (instead of per call) keeps numbers random
+ *              even if many of them are requested within one second.
  *
  *  @param      minval : Minimum value of generated random number
  *              maxval : Maximum value of generated random number
@@ -135,8 +224,7 @@ int Player::RandomNr::iRndNum (int minval, int maxval)
 {
     int rndval = 0;
 
-    srand (time(NULL));
-    rndval = rand();
+    rndval = oEngine();
 
     // Return ranged random value
     return rndval % maxval + minval;    // Value range: minval ... maxval
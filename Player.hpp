@@ -26,6 +26,7 @@
 
 /*------  System interface includes  -------*/
 #include <iostream>
+#include <random>       // std::minstd_rand
 #include <time.h>       // time(NULL)
 
 /*=============================================================================
@@ -40,6 +41,9 @@
 =====                               CLASSES                               =====
 =============================================================================*/
 
+class GameState;
+class Tablebase;
+
 class Player
 {
     public:
@@ -55,6 +59,10 @@ class Player
     /** Getter / Setter **/
         virtual void vSet_CurrentPlayer (bool _bCurrentPlayer);
         virtual bool bIs_CurrentPlayer  ();
+        virtual unsigned int uiGet_Seed ();     // Seed of machine moves
+
+    /** Member functions / methods **/
+        virtual short siMachine_Move    (const GameState& _oGameState);
 
     /** Nested class **/
         class RandomNr
@@ -64,11 +72,18 @@ class Player
                 RandomNr();
                 virtual ~RandomNr();
 
+            /** Getter / Setter **/
+                virtual void         vSet_Seed  (unsigned int _uiSeed);
+                virtual unsigned int uiGet_Seed ();
+
             /** Member functions / methods **/
                 virtual int iRndNum (int minval, int maxval);
 
             protected:
             private:
+            /** Variables **/
+                unsigned int        uiSeed;
+                std::minstd_rand    oEngine;
         };
 
     protected:
@@ -76,6 +91,9 @@ class Player
         RandomNr  oRandomNr;
 
     private:
+    /** Variables **/
+        const Tablebase*    pTable;         // Of last configuration
+        int                 iTable_Config;  // Board size and tokens, -1 none
 };
 
 #endif // _PLAYER_H_
@@ -0,0 +1,543 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    ProofSolver.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Proof-number solver
+ *           Depth-first proof-number search for the game theoretic value
+ *           of a position, for positions with narrow forced wins.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::min, std::max
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "ProofSolver.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class ProofSolver
+ *
+ *  @brief      Instantiates a ProofSolver object. The table is allocated
+ *              by the first search.
+ *  @param      -
+ ******************************************************************************/
+
+ProofSolver::ProofSolver()
+{
+    DEBUG_CONSTRUCTOR;
+
+    siProofBits   = PROOF_TABLE_BITS;
+    ullStored     = 0;
+    llCollections = 0;
+    siValue       = SOLVE_UNKNOWN;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class ProofSolver
+ *
+ *  @brief      Destroys this ProofSolver object
+ ******************************************************************************/
+
+ProofSolver::~ProofSolver()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   llGet_ProofSize
+ *
+ *  @brief      Counts the positions of the proof trees of the latest
+ *              search (proof of a win or loss, disproofs of both for a
+ *              draw); positions collected from the table count as leaves
+ *  @param      -
+ *  @return     Number of positions, zero if no search
+ ******************************************************************************/
+
+long long ProofSolver::llGet_ProofSize() const
+{
+    std::set<unsigned long long> setWin, setLoss;
+
+    if (siValue == SOLVE_UNKNOWN) return 0;
+
+    return (siValue != SOLVE_LOSS ? llTree_Size (tRoot, true,  setWin)  : 0) +
+           (siValue != SOLVE_WIN  ? llTree_Size (tRoot, false, setLoss) : 0);
+}
+
+
+/******************************************************************************
+ *  @function   llGet_Collections
+ *
+ *  @brief      Returns number of table collections of all searches
+ *  @param      -
+ *  @return     llCollections : Number of collections
+ ******************************************************************************/
+
+long long ProofSolver::llGet_Collections() const
+{
+    return llCollections;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_ProofBits
+ *
+ *  @brief      Sets size of the table of proof numbers, takes effect on
+ *              next search
+ *
+ *  @param      bits : Table holds 2^bits entries (10 ... 28)
+ *  @return     -
+ ******************************************************************************/
+
+void ProofSolver::vSet_ProofBits (short bits)
+{
+    siProofBits = std::max ((short)10, std::min ((short)28, bits));
+    vecProof.clear();
+}
+
+
+/******************************************************************************
+ *  @function   siSolve
+ *
+ *  @brief      Solves a position by proving a win of the side to move,
+ *              then a win of the opponent
+ *
+ *  @param      _oGameState : Position
+ *  @return     SOLVE_WIN, SOLVE_DRAW, SOLVE_LOSS for side to move,
+ *              SOLVE_UNKNOWN if board is not supported or game is over
+ ******************************************************************************/
+
+short ProofSolver::siSolve (const GameState& _oGameState)
+{
+    POSITION pos;
+    short    slots = siSlots, lines = siLines, tokens = siTokens;
+
+    siValue = SOLVE_UNKNOWN;
+
+    if (!bSet_Game (_oGameState, pos)) return SOLVE_UNKNOWN;
+
+    // Entries of another configuration are useless
+    if (vecProof.size() != (1ULL << siProofBits) ||
+        slots != siSlots || lines != siLines || tokens != siTokens)
+    {
+        vecProof.assign (1ULL << siProofBits, PROOF_ENTRY {~0ULL, 0, 0, 0, false});  // No valid key
+        ullStored = 0;
+    }
+    tRoot   = pos;
+    siRoot  = pos.moves;
+    siValue = bProve (pos, true) ? SOLVE_WIN : bProve (pos, false) ? SOLVE_LOSS : SOLVE_DRAW;
+
+    return siValue;
+}
+
+
+/******************************************************************************
+ *  @function   bProve
+ *
+ *  @brief      Proves or disproves a win of one player
+ *
+ *  @param      pos      : Position
+ *              attacker : true  if the side to move tries to win,
+ *                         false if the opponent tries to win
+ *  @return     bool     : true  if the win is proved
+ ******************************************************************************/
+
+bool ProofSolver::bProve (const POSITION& pos, bool attacker)
+{
+    unsigned int phi, delta;
+
+    TRACE_SPAN ("search", attacker ? "prove win" : "prove loss");
+    STATS (auto tStart = std::chrono::steady_clock::now());
+
+    if (!bEvaluate (pos, attacker, phi, delta))
+        vSearch (pos, attacker, PROOF_INFINITE, PROOF_INFINITE);
+
+    vLookup (pos, attacker, phi, delta);
+
+    STATS (tStats.iterations++);
+    STATS (tStats.seconds += std::chrono::duration<double> (std::chrono::steady_clock::now() - tStart).count());
+
+    // Goal of the side to move is reached if phi is zero
+    return attacker ? (phi == 0) : (delta == 0);
+}
+
+
+/******************************************************************************
+ *  @function   vSearch
+ *
+ *  @brief      Searches below a position until its proof numbers reach
+ *              a limit. The move with the smallest proof number of the
+ *              side to move is searched with limits up to where another
+ *              move would become cheaper.
+ *
+ *  @param      pos       : Position, not decided at once
+ *              attacker  : true  if the side to move tries to win
+ *              phi_max   : Limit of proof number of side to move
+ *              delta_max : Limit of proof number of opponent
+ *  @return     -
+ ******************************************************************************/
+
+void ProofSolver::vSearch (const POSITION& pos, bool attacker,
+                           unsigned int phi_max, unsigned int delta_max)
+{
+    short              slots[BOARD_SLOTS_MAX];
+    short              count = siChildren (pos, slots);
+    long long          start = llNodes;
+    unsigned int       phi, delta;
+
+    POSITION           child[BOARD_SLOTS_MAX];
+    unsigned long long key[BOARD_SLOTS_MAX];
+    unsigned int       phi_first[BOARD_SLOTS_MAX], delta_first[BOARD_SLOTS_MAX];
+    bool               decided[BOARD_SLOTS_MAX];
+
+    llNodes++;
+    STATS (tStats.nodes++;  tStats.depth[pos.moves - siRoot]++);
+    STATS (tStats.expanded++;  tStats.children += count);
+
+    // Moves are evaluated once, only the table changes while searching
+    for (short i = 0; i < count; i++)
+    {
+        child[i] = pos;
+        vPlay (child[i], slots[i]);
+
+        key[i]     = ullKey (child[i]);
+        decided[i] = bEvaluate (child[i], !attacker, phi_first[i], delta_first[i]);
+
+        if (!decided[i]) vEstimate (child[i], phi_first[i], delta_first[i]);
+    }
+
+    for (;;)
+    {
+        unsigned int phi_best = 0, delta_best = PROOF_INFINITE, delta_second = PROOF_INFINITE;
+        short        best     = 0;
+
+        delta = 0;
+
+        for (short i = 0; i < count; i++)
+        {
+            unsigned int child_phi = phi_first[i], child_delta = delta_first[i];
+
+            if (!decided[i]) bFind (key[i], !attacker, child_phi, child_delta);
+
+            // Opponent must reach its goal after every move, sums of
+            // transpositions stay below infinite
+            if (child_phi == PROOF_INFINITE)  delta = PROOF_INFINITE;
+            else if (delta < PROOF_INFINITE)  delta = std::min (delta + child_phi, PROOF_INFINITE - 1);
+
+            if (child_delta < delta_best)
+            {
+                delta_second = delta_best;
+                delta_best   = child_delta;
+                phi_best     = child_phi;
+                best         = i;
+            }
+            else if (child_delta < delta_second)  delta_second = child_delta;
+        }
+        phi = delta_best;
+
+        if (phi >= phi_max || delta >= delta_max) break;
+
+        vSearch (child[best], !attacker,
+                 (unsigned int)std::min (delta_max + (unsigned long long)phi_best - delta,
+                                         (unsigned long long)PROOF_INFINITE),
+                 (unsigned int)std::min ((unsigned long long)phi_max, delta_second + 1ULL));
+    }
+
+    vStore (pos, attacker, phi, delta, llNodes - start);
+}
+
+
+/******************************************************************************
+ *  @function   bEvaluate
+ *
+ *  @brief      Decides positions without search:
+ *              * A move completing a chain reaches the goal
+ *              * Full board or last move: a draw is the goal of the
+ *                player not trying to win
+ *              * Two threats of the opponent fail the goal
+ *              * Rules of follow-up play fail the goal
+ *
+ *  @param      pos      : Position
+ *              attacker : true  if the side to move tries to win
+ *              phi      : Receives proof number of side to move
+ *              delta    : Receives proof number of opponent
+ *  @return     bool     : true  if position is decided
+ ******************************************************************************/
+
+bool ProofSolver::bEvaluate (const POSITION& pos, bool attacker,
+                             unsigned int& phi, unsigned int& delta) const
+{
+    const short cells = siSlots * siLines;
+
+    for (short slot = 0; slot < siSlots && pos.moves < cells; slot++)
+    {
+        if (bCan_Play (pos, slot) && bWins (pos, slot)) {phi = 0;  delta = PROOF_INFINITE;  return true;}
+    }
+
+    if (pos.moves + 1 >= cells)
+    {
+        phi   = attacker ? PROOF_INFINITE : 0;
+        delta = attacker ? 0 : PROOF_INFINITE;
+        return true;
+    }
+
+    POSITION opponent = {pos.current ^ pos.mask, pos.mask, pos.moves};
+    short    threats  = 0;
+
+    for (short slot = 0; slot < siSlots; slot++)
+        if (bCan_Play (pos, slot) && bWins (opponent, slot)) threats++;
+
+    if (threats > 1) {phi = PROOF_INFINITE;  delta = 0;  return true;}
+
+    // A bound of draw only fails the goal of a side trying to win
+    short bound = bRules ? siRules (pos) : SOLVE_WIN;
+
+    if (bound == SOLVE_LOSS || (bound == SOLVE_DRAW && attacker))
+    {
+        STATS (tStats.rules++);
+        phi = PROOF_INFINITE;  delta = 0;
+        return true;
+    }
+
+    return false;
+}
+
+
+/******************************************************************************
+ *  @function   vLookup
+ *
+ *  @brief      Returns proof numbers of a position from the table, of
+ *              a decided position or estimated
+ *
+ *  @param      pos      : Position
+ *              attacker : true  if the side to move tries to win
+ *              phi      : Receives proof number of side to move
+ *              delta    : Receives proof number of opponent
+ *  @return     -
+ ******************************************************************************/
+
+void ProofSolver::vLookup (const POSITION& pos, bool attacker,
+                           unsigned int& phi, unsigned int& delta) const
+{
+    if (!bFind (ullKey (pos), attacker, phi, delta) && !bEvaluate (pos, attacker, phi, delta))
+        vEstimate (pos, phi, delta);
+}
+
+
+/******************************************************************************
+ *  @function   bFind
+ *
+ *  @brief      Returns proof numbers of a position from the table
+ *
+ *  @param      key        : Position key
+ *              attacker   : true  if the side to move tries to win
+ *              phi, delta : Receive proof numbers, unchanged if not found
+ *  @return     bool       : true  if position is in the table
+ ******************************************************************************/
+
+bool ProofSolver::bFind (unsigned long long key, bool attacker,
+                         unsigned int& phi, unsigned int& delta) const
+{
+    size_t bucket = tBucket (key);
+
+    STATS (tStats.probes++);
+
+    for (size_t i = bucket; i < bucket + PROOF_BUCKET; i++)
+    {
+        const PROOF_ENTRY& entry = vecProof[i];
+
+        if (entry.key == key && entry.attacker == attacker)
+        {
+            STATS (tStats.hits++);
+            phi = entry.phi;  delta = entry.delta;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/******************************************************************************
+ *  @function   vEstimate
+ *
+ *  @brief      Proof numbers of an unknown position: the side to move
+ *              needs one move, the opponent needs all moves
+ *
+ *  @param      pos        : Position, not decided at once
+ *              phi, delta : Receive proof numbers
+ *  @return     -
+ ******************************************************************************/
+
+void ProofSolver::vEstimate (const POSITION& pos, unsigned int& phi, unsigned int& delta) const
+{
+    short slots[BOARD_SLOTS_MAX];
+
+    phi   = 1;
+    delta = siChildren (pos, slots);
+}
+
+
+/******************************************************************************
+ *  @function   vStore
+ *
+ *  @brief      Stores proof numbers of a searched position. A full bucket
+ *              drops the entry of the smallest search, a nearly full
+ *              table is collected.
+ *
+ *  @param      pos        : Position
+ *              attacker   : true  if the side to move tries to win
+ *              phi, delta : Proof numbers
+ *              work       : Positions searched below
+ *  @return     -
+ ******************************************************************************/
+
+void ProofSolver::vStore (const POSITION& pos, bool attacker, unsigned int phi, unsigned int delta,
+                          unsigned long long work)
+{
+    unsigned long long key    = ullKey (pos);
+    size_t             bucket = tBucket (key);
+    PROOF_ENTRY*       store  = &vecProof[bucket];
+
+    for (size_t i = bucket; i < bucket + PROOF_BUCKET; i++)
+    {
+        PROOF_ENTRY& entry = vecProof[i];
+
+        if (entry.key == key && entry.attacker == attacker)  {work += entry.work;  store = &entry;  break;}
+        if (store->key != ~0ULL && (entry.key == ~0ULL || entry.work < store->work))  store = &entry;
+    }
+
+    if (store->key == ~0ULL) ullStored++;
+
+    store->key      = key;
+    store->phi      = phi;
+    store->delta    = delta;
+    store->work     = (unsigned int)std::min (work, 0xFFFFFFFFULL);
+    store->attacker = attacker;
+    STATS (tStats.stores++);
+
+    if (ullStored > vecProof.size() / 4 * 3) vCollect();
+}
+
+
+/******************************************************************************
+ *  @function   vCollect
+ *
+ *  @brief      Removes entries of the smallest searches until half of the
+ *              table is free; these are the cheapest to search again
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void ProofSolver::vCollect()
+{
+    for (unsigned long long work = 2; ullStored > vecProof.size() / 2; work *= 2)
+    {
+        for (PROOF_ENTRY& entry : vecProof)
+        {
+            if (entry.key != ~0ULL && entry.work < work) {entry.key = ~0ULL;  ullStored--;}
+        }
+    }
+    llCollections++;
+}
+
+
+/******************************************************************************
+ *  @function   siChildren
+ *
+ *  @brief      Lists moves of a position center first, only the blocking
+ *              move if the opponent has one threat
+ *
+ *  @param      pos   : Position, not decided at once
+ *              slots : Receives slot indexes
+ *  @return     Number of moves
+ ******************************************************************************/
+
+short ProofSolver::siChildren (const POSITION& pos, short* slots) const
+{
+    POSITION opponent = {pos.current ^ pos.mask, pos.mask, pos.moves};
+    short    count    = 0;
+
+    for (short slot = 0; slot < siSlots; slot++)
+    {
+        if (bCan_Play (pos, slot) && bWins (opponent, slot)) {slots[0] = slot;  return 1;}
+    }
+
+    for (short i = 0; i < siSlots; i++)
+    {
+        if (bCan_Play (pos, aOrder[i])) slots[count++] = aOrder[i];
+    }
+    return count;
+}
+
+
+/******************************************************************************
+ *  @function   llTree_Size
+ *
+ *  @brief      Counts positions of the proof tree of a searched position:
+ *              one move reaching the goal of the side to move, or all
+ *              moves if the goal fails. Transpositions count once.
+ *
+ *  @param      pos      : Position
+ *              attacker : true  if the side to move tries to win
+ *              setSeen  : Keys of counted positions
+ *  @return     Number of positions
+ ******************************************************************************/
+
+long long ProofSolver::llTree_Size (const POSITION& pos, bool attacker,
+                                    std::set<unsigned long long>& setSeen) const
+{
+    unsigned int phi, delta;
+
+    if (bEvaluate (pos, attacker, phi, delta)) return 1;
+    if (!setSeen.insert (ullKey (pos)).second) return 0;
+
+    vLookup (pos, attacker, phi, delta);
+
+    short     slots[BOARD_SLOTS_MAX];
+    short     count = siChildren (pos, slots);
+    long long size  = 1;
+
+    for (short i = 0; i < count && (phi == 0 || delta == 0); i++)
+    {
+        POSITION     child = pos;
+        unsigned int child_phi, child_delta;
+
+        vPlay (child, slots[i]);
+        vLookup (child, !attacker, child_phi, child_delta);
+
+        if (phi != 0)               size += llTree_Size (child, !attacker, setSeen);
+        else if (child_delta == 0)  return size + llTree_Size (child, !attacker, setSeen);
+    }
+    return size;
+}
+
+
+/******************************************************************************
+ *  @function   tBucket
+ *
+ *  @brief      Returns the first table entry of the bucket of a key
+ *
+ *  @param      key : Position key
+ *  @return     Table index
+ ******************************************************************************/
+
+size_t ProofSolver::tBucket (unsigned long long key) const
+{
+    return (size_t)((key * 0x9E3779B97F4A7C15ULL) >> (64 - siProofBits)) & ~(size_t)(PROOF_BUCKET - 1);
+}
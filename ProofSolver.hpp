@@ -0,0 +1,113 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    ProofSolver.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   ProofSolver
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _PROOFSOLVER_H_
+#define _PROOFSOLVER_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <set>
+#include <vector>
+
+/*------  Module header includes  -------*/
+#include "Solver.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Proof and disproof numbers  ***/
+#define PROOF_INFINITE      0x3FFFFFFFU
+
+/***  Table of proof numbers  ***/
+#define PROOF_TABLE_BITS    20      // 2^20 entries, 24 bytes each
+#define PROOF_BUCKET        4       // Entries per bucket
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Depth-first proof-number search (df-pn): proves or disproves a win
+ *  of one player, expanding the positions that are cheapest to prove
+ *  or disprove first instead of searching all moves to the same depth.
+ *  A win of the side to move is checked first, then a win of the
+ *  opponent; a position with neither is a draw. Proof numbers are kept
+ *  per side to move (phi: own goal, delta: opponent goal) in a table of
+ *  fixed size kept for all searches of a game; if it fills up, the
+ *  entries of the smallest searches are collected.                    */
+
+class ProofSolver : public Solver
+{
+    public:
+    /** Constructor / Destructor **/
+                 ProofSolver();
+        virtual ~ProofSolver();
+
+    /** Getter / Setter **/
+        long long   llGet_ProofSize     () const;
+        long long   llGet_Collections   () const;
+        void        vSet_ProofBits      (short bits);
+
+    /** Member functions / methods **/
+        virtual short   siSolve     (const GameState& _oGameState);
+
+    private:
+    /** Types / Structs **/
+        typedef struct
+        {
+            unsigned long long  key;
+            unsigned int        phi;        // Proof number of side to move
+            unsigned int        delta;      // Proof number of opponent
+            unsigned int        work;       // Searched positions
+            bool                attacker;   // Side to move tries to win
+        } PROOF_ENTRY;
+
+    /** Variables **/
+        std::vector<PROOF_ENTRY>    vecProof;
+        short                       siProofBits;
+        unsigned long long          ullStored;
+        long long                   llCollections;
+
+        POSITION                    tRoot;          // Position of latest search
+        short                       siValue;
+
+    /** Member functions / methods **/
+        bool    bProve          (const POSITION& pos, bool attacker);
+        void    vSearch         (const POSITION& pos, bool attacker,
+                                 unsigned int phi_max, unsigned int delta_max);
+        bool    bEvaluate       (const POSITION& pos, bool attacker,
+                                 unsigned int& phi, unsigned int& delta) const;
+        void    vLookup         (const POSITION& pos, bool attacker,
+                                 unsigned int& phi, unsigned int& delta) const;
+        bool    bFind           (unsigned long long key, bool attacker,
+                                 unsigned int& phi, unsigned int& delta) const;
+        void    vEstimate       (const POSITION& pos, unsigned int& phi, unsigned int& delta) const;
+        void    vStore          (const POSITION& pos, bool attacker, unsigned int phi, unsigned int delta,
+                                 unsigned long long work);
+        void    vCollect        ();
+        short   siChildren      (const POSITION& pos, short* slots) const;
+        long long llTree_Size   (const POSITION& pos, bool attacker,
+                                 std::set<unsigned long long>& setSeen) const;
+
+        size_t              tBucket (unsigned long long key) const;
+};
+
+#endif // _PROOFSOLVER_H_
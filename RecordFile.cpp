@@ -0,0 +1,219 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    RecordFile.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Game record file mapping
+ *           Maps a record file into memory (mmap / file mapping) and
+ *           finds its blocks.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <cstring>      // std::memcmp
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "RecordFile.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class RecordFile
+ *
+ *  @brief      Instantiates a RecordFile object without mapping
+ *  @param      -
+ ******************************************************************************/
+
+RecordFile::RecordFile()
+{
+    DEBUG_CONSTRUCTOR;
+
+    pData = NULL;
+    tSize = 0;
+
+#ifdef _WIN32
+    hFile    = INVALID_HANDLE_VALUE;
+    hMapping = NULL;
+#else
+    iFile    = -1;
+#endif
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class RecordFile
+ *
+ *  @brief      Unmaps and closes the file
+ ******************************************************************************/
+
+RecordFile::~RecordFile()
+{
+    DEBUG_DESTRUCTOR;
+
+    vClose();
+}
+
+
+/******************************************************************************
+ *  @function   pGet_Data
+ *
+ *  @brief      Returns begin of mapped file content
+ *  @param      -
+ *  @return     pData : File content, NULL if no file is mapped
+ ******************************************************************************/
+
+const unsigned char* RecordFile::pGet_Data() const
+{
+    return pData;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Size
+ *
+ *  @brief      Returns size of mapped file
+ *  @param      -
+ *  @return     tSize : Number of bytes
+ ******************************************************************************/
+
+size_t RecordFile::tGet_Size() const
+{
+    return tSize;
+}
+
+
+/******************************************************************************
+ *  @function   bOpen
+ *
+ *  @brief      Maps a file read-only into memory
+ *
+ *  @param      path       : File name
+ *              sequential : Read ahead for scans, else for random access
+ *  @return     bool       : false  if file can not be mapped
+ ******************************************************************************/
+
+bool RecordFile::bOpen (const std::string& path, bool sequential)
+{
+    vClose();
+
+#ifdef _WIN32
+    LARGE_INTEGER size;
+
+    hFile = CreateFileA (path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                         OPEN_EXISTING,
+                         sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (hFile == INVALID_HANDLE_VALUE || !GetFileSizeEx (hFile, &size)) return false;
+
+    tSize = size.QuadPart;
+    if (tSize == 0) return true;        // Nothing to map
+
+    hMapping = CreateFileMappingA (hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hMapping == NULL) {vClose();  return false;}
+
+    pData = (const unsigned char*)MapViewOfFile (hMapping, FILE_MAP_READ, 0, 0, 0);
+#else
+    struct stat info;
+
+    iFile = open (path.c_str(), O_RDONLY);
+    if (iFile < 0 || fstat (iFile, &info) != 0) return false;
+
+    tSize = info.st_size;
+    if (tSize == 0) return true;        // Nothing to map
+
+    void* map = mmap (NULL, tSize, PROT_READ, MAP_PRIVATE, iFile, 0);
+
+    if (map != MAP_FAILED)
+    {
+        madvise (map, tSize, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+        pData = (const unsigned char*)map;
+    }
+#endif
+
+    if (pData == NULL) {vClose();  return false;}
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   vClose
+ *
+ *  @brief      Unmaps and closes the file
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void RecordFile::vClose()
+{
+#ifdef _WIN32
+    if (pData    != NULL)                 UnmapViewOfFile (pData);
+    if (hMapping != NULL)                 CloseHandle (hMapping);
+    if (hFile    != INVALID_HANDLE_VALUE) CloseHandle (hFile);
+
+    hFile    = INVALID_HANDLE_VALUE;
+    hMapping = NULL;
+#else
+    if (pData != NULL) munmap ((void*)pData, tSize);
+    if (iFile >= 0)    close  (iFile);
+
+    iFile = -1;
+#endif
+
+    pData = NULL;
+    tSize = 0;
+}
+
+
+/******************************************************************************
+ *  @function   bIndex_Blocks
+ *
+ *  @brief      Finds the record payload of all blocks by walking the
+ *              block headers. Record data itself is not touched.
+ *
+ *  @param      blocks : Receives payload span of each block
+ *  @return     bool   : false  if file is corrupt or truncated after
+ *                              the last valid block
+ ******************************************************************************/
+
+bool RecordFile::bIndex_Blocks (std::vector<SPAN>& blocks) const
+{
+    size_t pos = 0;
+
+    blocks.clear();
+
+    while (pos + RECORD_BLOCK_HEADER <= tSize)
+    {
+        const unsigned char* header = pData + pos;
+
+        size_t payload = header[4]       | header[5] << 8 |
+                         header[6] << 16 | (size_t)header[7] << 24;
+
+        if (std::memcmp (header, RECORD_MAGIC, 4) != 0  ||
+            pos + RECORD_BLOCK_HEADER + payload > tSize)  return false;
+
+        blocks.push_back ({header + RECORD_BLOCK_HEADER, header + RECORD_BLOCK_HEADER + payload});
+        pos += RECORD_BLOCK_HEADER + payload;
+    }
+    return pos == tSize;
+}
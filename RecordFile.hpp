@@ -0,0 +1,77 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    RecordFile.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   RecordFile
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _RECORDFILE_H_
+#define _RECORDFILE_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <cstddef>      // size_t
+#include <string>
+#include <vector>
+
+/*------  Module header includes  -------*/
+#include "GameRecord.hpp"
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Read-only memory mapping of a game record file. Records are read
+ *  in place from the mapping, nothing is copied. Blocks of the file
+ *  can be indexed to split it at record boundaries.                   */
+
+class RecordFile
+{
+    public:
+    /** Types / Structs **/
+        typedef struct {const unsigned char* begin; const unsigned char* end;} SPAN;
+
+    /** Constructor / Destructor **/
+                 RecordFile();
+        virtual ~RecordFile();
+
+    /** Getter / Setter **/
+        const unsigned char*    pGet_Data   () const;
+        size_t                  tGet_Size   () const;
+
+    /** Member functions / methods **/
+        bool    bOpen           (const std::string& path, bool sequential = true);
+        void    vClose          ();
+        bool    bIndex_Blocks   (std::vector<SPAN>& blocks) const;   // Payloads
+
+    private:
+    /** Variables **/
+        const unsigned char*    pData;
+        size_t                  tSize;
+
+#ifdef _WIN32
+        void*                   hFile;
+        void*                   hMapping;
+#else
+        int                     iFile;
+#endif
+
+    /** Constructor **/
+        RecordFile (const RecordFile&);     // Mapping is not copyable
+};
+
+#endif // _RECORDFILE_H_
@@ -0,0 +1,159 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    RecordWriter.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Game record writer
+ *           Appends packed game records block by block to a file.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <cstring>      // std::memcpy
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "RecordWriter.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class RecordWriter
+ *
+ *  @brief      Instantiates a RecordWriter object without file
+ *  @param      -
+ ******************************************************************************/
+
+RecordWriter::RecordWriter()
+{
+    DEBUG_CONSTRUCTOR;
+
+    tBlockUsed = RECORD_BLOCK_HEADER;
+    liRecords  = 0;
+    liDropped  = 0;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class RecordWriter
+ *
+ *  @brief      Writes buffered records and closes the file
+ ******************************************************************************/
+
+RecordWriter::~RecordWriter()
+{
+    DEBUG_DESTRUCTOR;
+
+    vFlush();
+}
+
+
+/******************************************************************************
+ *  @function   liGet_Records
+ *
+ *  @brief      Returns number of records appended since file was opened
+ *  @param      -
+ *  @return     liRecords : Number of records
+ ******************************************************************************/
+
+long RecordWriter::liGet_Records() const
+{
+    return liRecords;
+}
+
+
+/******************************************************************************
+ *  @function   liGet_Dropped
+ *
+ *  @brief      Returns number of records dropped as no file was open
+ *  @param      -
+ *  @return     liDropped : Number of records
+ ******************************************************************************/
+
+long RecordWriter::liGet_Dropped() const
+{
+    return liDropped;
+}
+
+
+/******************************************************************************
+ *  @function   bOpen
+ *
+ *  @brief      Opens a record file for appending, creates it if needed
+ *
+ *  @param      path : File name
+ *  @return     bool : false  if file can not be opened
+ ******************************************************************************/
+
+bool RecordWriter::bOpen (const std::string& path)
+{
+    vFlush();
+    if (oFile.is_open()) oFile.close();
+
+    oFile.open (path, std::ios::binary | std::ios::app);
+    liRecords = 0;
+
+    return oFile.is_open();
+}
+
+
+/******************************************************************************
+ *  @function   vAppend
+ *
+ *  @brief      Appends a record to the block buffer.
+ *              A full block is written to the file first.
+ *              Without open file the record is dropped.
+ *
+ *  @param      _oRecord : Game record
+ *  @return     -
+ ******************************************************************************/
+
+void RecordWriter::vAppend (const GameRecord& _oRecord)
+{
+    if (!oFile.is_open()) {liDropped++;  return;}
+
+    if (tBlockUsed + _oRecord.tGet_Size() > RECORD_BLOCK_SIZE) vFlush();
+
+    tBlockUsed += _oRecord.tEncode (aBlock + tBlockUsed);
+    liRecords++;
+}
+
+
+/******************************************************************************
+ *  @function   vFlush
+ *
+ *  @brief      Writes buffered records as one block to the file.
+ *              The block is empty afterwards, also if no file is open.
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void RecordWriter::vFlush()
+{
+    size_t payload = tBlockUsed - RECORD_BLOCK_HEADER;
+
+    if (payload == 0) return;
+
+    if (!oFile.is_open()) {tBlockUsed = RECORD_BLOCK_HEADER;  return;}
+
+    // Block header: magic and payload size (little endian)
+    std::memcpy (aBlock, RECORD_MAGIC, 4);
+    aBlock[4] = payload;        aBlock[5] = payload >> 8;
+    aBlock[6] = payload >> 16;  aBlock[7] = payload >> 24;
+
+    oFile.write ((const char*)aBlock, tBlockUsed);
+    oFile.flush();
+
+    tBlockUsed = RECORD_BLOCK_HEADER;
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    RecordWriter.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   RecordWriter
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _RECORDWRITER_H_
+#define _RECORDWRITER_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <fstream>
+#include <string>
+
+/*------  Module header includes  -------*/
+#include "GameRecord.hpp"
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Buffered, append-only writer of a game record file. Records are
+ *  collected in a block buffer which is written with one call when
+ *  the next record does not fit, on vFlush() and on destruction.
+ *  Records appended while no file is open are dropped and counted.    */
+
+class RecordWriter
+{
+    public:
+    /** Constructor / Destructor **/
+                 RecordWriter();
+        virtual ~RecordWriter();
+
+    /** Getter / Setter **/
+        virtual long    liGet_Records   () const;   // Records appended
+        virtual long    liGet_Dropped   () const;   // Records without file
+
+    /** Member functions / methods **/
+        virtual bool    bOpen           (const std::string& path);
+        virtual void    vAppend         (const GameRecord& _oRecord);
+        virtual void    vFlush          ();         // Write block to file
+
+    private:
+    /** Variables **/
+        std::ofstream   oFile;
+        unsigned char   aBlock[RECORD_BLOCK_SIZE];  // Block header and records
+        size_t          tBlockUsed;                 // Bytes used incl. header
+        long            liRecords;
+        long            liDropped;
+};
+
+#endif // _RECORDWRITER_H_
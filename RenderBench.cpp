@@ -0,0 +1,198 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    RenderBench.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Rendering benchmark
+ *           Replays games on the mock console and reports frames per
+ *           second, bytes and console calls per move for each board size.
+ *           The screen hash is the golden value of the final screen.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <chrono>       // steady_clock
+#include <iomanip>      // std::setw
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "RenderBench.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class RenderBench
+ *
+ *  @brief      Instantiates a RenderBench object
+ *  @param      -
+ ******************************************************************************/
+
+RenderBench::RenderBench()
+{
+    DEBUG_CONSTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class RenderBench
+ *
+ *  @brief      Destroys this RenderBench object
+ ******************************************************************************/
+
+RenderBench::~RenderBench()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   vRun
+ *
+ *  @brief      Runs the benchmark for a set of board sizes and prints
+ *              one result line per board size
+ *
+ *  @param      games : Number of games replayed per board size
+ *  @return     -
+ ******************************************************************************/
+
+void RenderBench::vRun (long games)
+{
+    static const BOARD sizes[] = {{BOARD_SLOTS_MIN, BOARD_LINES_MIN},
+                                  {BOARD_SLOTS,     BOARD_LINES    },
+                                  {10,              10             },
+                                  {BOARD_SLOTS_MAX, BOARD_LINES_MAX}};
+
+    std::cout << "  Board   Frames/s    Bytes/move  Calls/move  Screen hash\n";
+
+    for (const BOARD& size : sizes)  vRun_BoardSize (size.slot, size.line, games);
+}
+
+
+/******************************************************************************
+ *  @function   vShow_Screen
+ *
+ *  @brief      Replays one game and prints the final virtual screen
+ *              (golden screen)
+ *
+ *  @param      slots, lines : Board size
+ *  @return     -
+ ******************************************************************************/
+
+void RenderBench::vShow_Screen (short slots, short lines)
+{
+    oGameState.vSet_BoardSize ({slots, lines});
+    oRandomNr.vSet_Seed (BENCH_SEED);
+
+    liReplay_Game();
+
+    std::cout << sGet_Screen();
+}
+
+
+/******************************************************************************
+ *  @function   vRun_BoardSize
+ *
+ *  @brief      Replays games on one board size and prints the results
+ *
+ *  @param      slots, lines : Board size
+ *              games        : Number of games
+ *  @return     -
+ ******************************************************************************/
+
+void RenderBench::vRun_BoardSize (short slots, short lines, long games)
+{
+    long moves = 0;
+
+    oGameState.vSet_BoardSize ({slots, lines});
+    oRandomNr.vSet_Seed (BENCH_SEED);
+    vReset_Stats();
+
+    auto tStart = std::chrono::steady_clock::now();
+
+    for (long game = 0; game < games; game++)  moves += liReplay_Game();
+
+    double runtime = std::chrono::duration<double> (std::chrono::steady_clock::now() - tStart).count();
+
+    OUTPUT_STATS stats = tGet_Stats();
+
+    if (moves == 0 || runtime <= 0) return;
+
+    std::cout << "  " << std::setw(2) << slots << "x" << std::left << std::setw(2) << lines << std::right
+              << std::setw(11) << (long)(stats.frames / runtime)
+              << std::setw(14) << stats.bytes / moves
+              << std::setw(12) << (double)stats.calls / moves
+              << "    "        << std::hex << uiHash (sGet_Screen()) << std::dec << std::endl;
+}
+
+
+/******************************************************************************
+ *  @function   liReplay_Game
+ *
+ *  @brief      Plays one machine game through the screen functions:
+ *              start screen, token above slot and all token drop steps
+ *              of each move. Every step is one frame.
+ *  @param      -
+ *  @return     Number of moves played
+ ******************************************************************************/
+
+long RenderBench::liReplay_Game()
+{
+    short slot, player;
+    long  moves = 0;
+
+    oGameState.vReset();
+    vUpdate_Screen();  vFlush();
+
+    while (oGameState.siCheck_WinState() == 0  &&  oGameState.siGet_FreeSlots() > 0)
+    {
+        player = oGameState.siGet_CurrentPlayer();
+        slot   = siMachine_Move (oGameState);
+
+        vCurPos_Set (Pos_SlotSelect);
+        vShow_SlotSelect (slot, player == PLAYER_1_ID ? COL_YELLOW : COL_RED);  vFlush();
+
+        oGameState.bPlay_Move (slot);
+
+        // Token falls two screen rows per board line down to its field
+        short steps = 2 * (oGameState.tGet_BoardSize().line - oGameState.siGet_SlotHeight (slot) + 1);
+
+        vCursor_Visible (false);
+        for (short step = 0; step < steps; step++)
+        {
+            vCurPos_Set (Pos_Board);
+            vAnimate_TokenDrop (player, slot, step);  vFlush();
+        }
+        moves++;
+    }
+    return moves;
+}
+
+
+/******************************************************************************
+ *  @function   uiHash
+ *
+ *  @brief      Hash value of a string (FNV-1a)
+ *
+ *  @param      str : String
+ *  @return     Hash value
+ ******************************************************************************/
+
+unsigned int RenderBench::uiHash (const std::string& str)
+{
+    unsigned int hash = 2166136261u;
+
+    for (unsigned char chr : str)  hash = (hash ^ chr) * 16777619u;
+
+    return hash;
+}
@@ -0,0 +1,69 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    RenderBench.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   RenderBench
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _RENDERBENCH_H_
+#define _RENDERBENCH_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <iostream>
+#include <string>
+
+/*------  Module header includes  -------*/
+#include "Dialog.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Seed of replayed games, same seed gives same screens  ***/
+#define BENCH_SEED          4242
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Rendering benchmark on the mock console. Replays machine games
+ *  through the screen functions of the game and measures what the
+ *  console backend would emit. Console has to be in mock mode.        */
+
+class RenderBench : public Dialog
+{
+    public:
+    /** Constructor / Destructor **/
+                 RenderBench();
+        virtual ~RenderBench();
+
+    /** Member functions / methods **/
+        virtual void    vRun            (long games);
+        virtual void    vShow_Screen    (short slots, short lines);
+
+    protected:
+    /** Member functions / methods **/
+        virtual void    vRun_BoardSize  (short slots, short lines, long games);
+        virtual long    liReplay_Game   ();
+
+    private:
+    /** Member functions / methods **/
+        static unsigned int uiHash      (const std::string& str);
+};
+
+#endif // _RENDERBENCH_H_
@@ -0,0 +1,202 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Scheduler.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Match scheduler
+ *           Interleaves many matches on a single thread by advancing
+ *           each match one step at a time (round robin).
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <chrono>       // steady_clock
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "Scheduler.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class Scheduler
+ *
+ *  @brief      Instantiates a Scheduler object without matches
+ *  @param      -
+ ******************************************************************************/
+
+Scheduler::Scheduler()
+{
+    DEBUG_CONSTRUCTOR;
+
+    liGames_Left = 0;
+    pRecorder    = NULL;
+    liResults[0] = 0;  liResults[1] = 0;  liResults[2] = 0;
+    dRunTime     = 0;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class Scheduler
+ *
+ *  @brief      Destroys this Scheduler object
+ ******************************************************************************/
+
+Scheduler::~Scheduler()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Recorder
+ *
+ *  @brief      Sets record writer for finished games
+ *
+ *  @param      _pRecorder : Record writer, NULL for no recording
+ *  @return     -
+ ******************************************************************************/
+
+void Scheduler::vSet_Recorder (RecordWriter* _pRecorder)
+{
+    pRecorder = _pRecorder;
+}
+
+
+/******************************************************************************
+ *  @function   vAdd_Match
+ *
+ *  @brief      Adds a match to the set of interleaved matches
+ *
+ *  @param      _oMatch : Match to be driven by this scheduler
+ *  @return     -
+ ******************************************************************************/
+
+void Scheduler::vAdd_Match (const Match& _oMatch)
+{
+    vecMatches.push_back (_oMatch);
+}
+
+
+/******************************************************************************
+ *  @function   bStep
+ *
+ *  @brief      Advances every match by one step
+ *              * Machine moves are requested from the machine player
+ *              * Outstanding animation frames are supplied
+ *              * Finished matches are counted and restarted as long as
+ *                games are left, otherwise removed
+ *              Matches waiting for a human move are skipped, their moves
+ *              have to be supplied by the input handling.
+ *  @param      -
+ *  @return     bool : true   if at least one match is left
+ *                     false  if all matches are finished
+ ******************************************************************************/
+
+bool Scheduler::bStep()
+{
+    size_t i = 0;
+
+    while (i < vecMatches.size())
+    {
+        Match& oMatch = vecMatches[i];
+
+        switch (oMatch.tGet_Phase())
+        {
+            case Match::AWAIT_MACHINE :
+                oMatch.bSupply_Move (oMachine.siMachine_Move (oMatch.oGet_GameState()));
+                break;
+
+            case Match::AWAIT_FRAME   :
+                oMatch.vSupply_Frame();
+                break;
+
+            case Match::AWAIT_HUMAN   :
+                break;
+
+            case Match::FINISHED      :
+                liResults[oMatch.siGet_Winner()]++;
+
+                if (pRecorder)
+                    pRecorder->vAppend (GameRecord (oMatch.oGet_GameState(),
+                                                    oMatch.siGet_Winner(), oMachine.uiGet_Seed()));
+
+                // Start next game or drop the match if no games are left
+                if (liGames_Left > 0) {liGames_Left--;  oMatch.vRestart();}
+                else
+                {
+                    vecMatches[i] = vecMatches.back();
+                    vecMatches.pop_back();
+                    continue;
+                }
+                break;
+        }
+        i++;
+    }
+    return !vecMatches.empty();
+}
+
+
+/******************************************************************************
+ *  @function   vRun_SelfPlay
+ *
+ *  @brief      Plays machine against machine games without console output.
+ *              Up to "parallel" games are interleaved on this thread.
+ *
+ *  @param      _oGameState : Rules and start player of all games
+ *              games       : Number of games to play
+ *              parallel    : Number of games interleaved at the same time
+ *  @return     -
+ ******************************************************************************/
+
+void Scheduler::vRun_SelfPlay (const GameState& _oGameState, long games, short parallel)
+{
+    if (parallel < 1)     parallel = 1;
+    if (parallel > games) parallel = games;
+
+    vecMatches.clear();
+    for (short i = 0; i < parallel; i++)  vAdd_Match (Match (_oGameState, true, true));
+
+    liGames_Left = games - parallel;
+    liResults[0] = 0;  liResults[1] = 0;  liResults[2] = 0;
+
+    auto tStart = std::chrono::steady_clock::now();
+
+    while (bStep());
+
+    dRunTime = std::chrono::duration<double> (std::chrono::steady_clock::now() - tStart).count();
+}
+
+
+/******************************************************************************
+ *  @function   vShow_Results
+ *
+ *  @brief      Prints results of last self-play run
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void Scheduler::vShow_Results()
+{
+    long games = liResults[0] + liResults[1] + liResults[2];
+
+    std::cout << "  Games played         : " << games        << "\n"
+                 "  Won by player 1      : " << liResults[1] << "\n"
+                 "  Won by player 2      : " << liResults[2] << "\n"
+                 "  Tie games            : " << liResults[0] << "\n"
+                 "  Run time [s]         : " << dRunTime     << "\n";
+
+    if (dRunTime > 0)
+    std::cout << "  Games per second     : " << games / dRunTime << std::endl;
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Scheduler.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   Scheduler
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <iostream>
+#include <vector>
+
+/*------  Module header includes  -------*/
+#include "Match.hpp"
+#include "Player.hpp"
+#include "RecordWriter.hpp"
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+class Scheduler
+{
+    public:
+    /** Constructor / Destructor **/
+                 Scheduler();
+        virtual ~Scheduler();
+
+    /** Member functions / methods **/
+        virtual void    vSet_Recorder   (RecordWriter* _pRecorder);
+        virtual void    vAdd_Match      (const Match& _oMatch);
+        virtual bool    bStep           ();
+        virtual void    vRun_SelfPlay   (const GameState& _oGameState,
+                                         long games, short parallel);
+        virtual void    vShow_Results   ();
+
+    protected:
+    /** Objects **/
+        Player              oMachine;       // Move source for machine players
+        std::vector<Match>  vecMatches;     // Interleaved matches
+
+    private:
+    /** Variables **/
+        long    liGames_Left;               // Games still to be started
+        RecordWriter* pRecorder;            // Records finished games if set
+        long    liResults[3];               // Tie games, won by player 1, player 2
+        double  dRunTime;                   // Seconds of last self-play run
+};
+
+#endif // _SCHEDULER_H_
@@ -0,0 +1,858 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Solver.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Game solver
+ *           Alpha-beta search with transposition table for the game
+ *           theoretic value (win, draw, loss) of a position.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::min, std::max
+#include <cstdio>       // std::rename, std::remove
+#include <cstring>      // std::memcpy, std::memcmp
+#include <fstream>
+#include <sstream>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "RecordFile.hpp"
+#include "Solver.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Bounds of table entries  ***/
+#define BOUND_EXACT     0
+#define BOUND_LOWER     1
+#define BOUND_UPPER     2
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class Solver
+ *
+ *  @brief      Instantiates a Solver object. The transposition table is
+ *              allocated by the first search.
+ *  @param      -
+ ******************************************************************************/
+
+Solver::Solver()
+{
+    DEBUG_CONSTRUCTOR;
+
+    siSlots = siLines = siTokens = siRoot = 0;
+    llNodes     = 0;
+    siTableBits = SOLVE_TABLE_BITS;
+    bRules      = true;
+    tInterval   = std::chrono::seconds (0);
+    dSaveTime   = 0;
+    vReset_Stats();
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class Solver
+ *
+ *  @brief      Destroys this Solver object
+ ******************************************************************************/
+
+Solver::~Solver()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   llGet_Nodes
+ *
+ *  @brief      Returns number of searched positions of all searches
+ *  @param      -
+ *  @return     llNodes : Number of positions
+ ******************************************************************************/
+
+long long Solver::llGet_Nodes() const
+{
+    return llNodes;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Stats
+ *
+ *  @brief      Returns search statistics since the last reset, counted
+ *              only if SEARCH_STATS is defined
+ *  @param      -
+ *  @return     tStats : Statistics
+ ******************************************************************************/
+
+const Solver::SOLVE_STATS& Solver::tGet_Stats() const
+{
+    return tStats;
+}
+
+
+/******************************************************************************
+ *  @function   vReset_Stats
+ *
+ *  @brief      Sets all search statistics to zero
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void Solver::vReset_Stats()
+{
+    std::memset (&tStats, 0, sizeof(tStats));
+}
+
+
+/******************************************************************************
+ *  @function   dGet_SaveTime
+ *
+ *  @brief      Returns time spent writing checkpoints
+ *  @param      -
+ *  @return     dSaveTime : Seconds
+ ******************************************************************************/
+
+double Solver::dGet_SaveTime() const
+{
+    return dSaveTime;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_TableBits
+ *
+ *  @brief      Sets size of transposition table, takes effect on next search
+ *
+ *  @param      bits : Table holds 2^bits entries (10 ... 30)
+ *  @return     -
+ ******************************************************************************/
+
+void Solver::vSet_TableBits (short bits)
+{
+    siTableBits = std::max ((short)10, std::min ((short)30, bits));
+    vecTable.clear();
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Rules
+ *
+ *  @brief      Switches bounds of positions by rules of follow-up play
+ *              on or off, see siRules
+ *
+ *  @param      rules : true  if rules bound the search
+ *  @return     -
+ ******************************************************************************/
+
+void Solver::vSet_Rules (bool rules)
+{
+    bRules = rules;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Checkpoint
+ *
+ *  @brief      Sets file of checkpoints. A search starts from the table
+ *              of an existing checkpoint of the same game and saves its
+ *              table every interval, so an interrupted search resumes
+ *              with all positions known at the latest checkpoint.
+ *
+ *  @param      path    : Checkpoint file, empty for no checkpoints
+ *              seconds : Interval of checkpoints
+ *  @return     -
+ ******************************************************************************/
+
+void Solver::vSet_Checkpoint (const std::string& path, short seconds)
+{
+    sCheckpoint = path;
+    tInterval   = std::chrono::seconds (std::max ((short)1, seconds));
+}
+
+
+/******************************************************************************
+ *  @function   siSolve
+ *
+ *  @brief      Solves a position
+ *
+ *  @param      _oGameState : Position
+ *  @return     SOLVE_WIN, SOLVE_DRAW, SOLVE_LOSS for side to move,
+ *              SOLVE_UNKNOWN if board is not supported or game is over
+ ******************************************************************************/
+
+short Solver::siSolve (const GameState& _oGameState)
+{
+    POSITION pos;
+    short    slots = siSlots, lines = siLines, tokens = siTokens;
+
+    if (!bSet_Game (_oGameState, pos)) return SOLVE_UNKNOWN;
+
+    // Table entries of another configuration are useless
+    if (vecTable.size() != (1ULL << siTableBits) ||
+        slots != siSlots || lines != siLines || tokens != siTokens)
+        vecTable.assign (1ULL << siTableBits, TABLE_ENTRY {~0ULL, 0, 0, 0});     // No valid key
+
+    // Entries hold true bounds of any search, the result stays the same
+    if (!sCheckpoint.empty())
+    {
+        bLoad_Table (sCheckpoint);
+        tNextSave = std::chrono::steady_clock::now() + tInterval;
+    }
+
+    siRoot = pos.moves;
+
+    TRACE_SPAN ("search", "solve");
+    STATS (auto tStart = std::chrono::steady_clock::now());
+
+    short value = siNegamax (pos, SOLVE_LOSS, SOLVE_WIN);
+
+    STATS (tStats.iterations++);
+    STATS (tStats.seconds += std::chrono::duration<double> (std::chrono::steady_clock::now() - tStart).count());
+
+    return value;
+}
+
+
+/******************************************************************************
+ *  @function   bSave_Table
+ *
+ *  @brief      Streams the transposition table to a file. The file is
+ *              written beside and renamed, so a complete checkpoint is
+ *              kept if writing is interrupted.
+ *
+ *  @param      path : Checkpoint file
+ *  @return     bool : false  if no table or file can not be written
+ ******************************************************************************/
+
+bool Solver::bSave_Table (const std::string& path) const
+{
+    if (vecTable.empty()) return false;
+
+    std::string       temp   = path + ".tmp";
+    CHECKPOINT_HEADER header = {};
+
+    std::memcpy (header.magic, SOLVE_MAGIC, 4);
+    header.version = SOLVE_VERSION;
+    header.slots   = siSlots;  header.lines = siLines;  header.tokens = siTokens;
+    header.bits    = siTableBits;
+    header.entries = vecTable.size();
+
+    {
+        std::ofstream oFile (temp, std::ios::binary | std::ios::trunc);
+
+        oFile.write ((const char*)&header, sizeof(header));
+        oFile.write ((const char*)vecTable.data(), vecTable.size() * sizeof(TABLE_ENTRY));
+
+        if (!oFile.good()) {oFile.close();  std::remove (temp.c_str());  return false;}
+    }
+
+    // Windows does not replace an existing file
+    if (std::rename (temp.c_str(), path.c_str()) != 0)
+    {
+        std::remove (path.c_str());
+        if (std::rename (temp.c_str(), path.c_str()) != 0) return false;
+    }
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   bLoad_Table
+ *
+ *  @brief      Reads the transposition table from a mapped checkpoint
+ *              of the game set by the latest search
+ *
+ *  @param      path : Checkpoint file
+ *  @return     bool : false  if file can not be mapped, is no checkpoint
+ *                            or belongs to another game
+ ******************************************************************************/
+
+bool Solver::bLoad_Table (const std::string& path)
+{
+    RecordFile oFile;
+
+    if (!oFile.bOpen (path) || oFile.tGet_Size() < sizeof(CHECKPOINT_HEADER)) return false;
+
+    const CHECKPOINT_HEADER* header = (const CHECKPOINT_HEADER*)oFile.pGet_Data();
+
+    if (std::memcmp (header->magic, SOLVE_MAGIC, 4) != 0  ||  header->version != SOLVE_VERSION  ||
+        header->slots != siSlots  ||  header->lines != siLines  ||  header->tokens != siTokens  ||
+        header->bits < 10  ||  header->bits > 30  ||  header->entries != (1ULL << header->bits)  ||
+        oFile.tGet_Size() != sizeof(CHECKPOINT_HEADER) + header->entries * sizeof(TABLE_ENTRY))
+        return false;
+
+    siTableBits = header->bits;
+    vecTable.resize (header->entries);
+    std::memcpy (vecTable.data(), header + 1, header->entries * sizeof(TABLE_ENTRY));
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   bSupported
+ *
+ *  @brief      Checks if a board fits into 64 bit boards with guard line
+ *
+ *  @param      slots, lines : Board size
+ *  @return     bool         : true  if board can be solved
+ ******************************************************************************/
+
+bool Solver::bSupported (short slots, short lines)
+{
+    return slots * (lines + 1) <= 64;
+}
+
+
+/******************************************************************************
+ *  @function   ullGet_Key
+ *
+ *  @brief      Returns the key of a position used by the transposition
+ *              table: equal for a position and its mirror image
+ *
+ *  @param      _oGameState : Position
+ *  @return     Key, zero if board is not supported
+ ******************************************************************************/
+
+unsigned long long Solver::ullGet_Key (const GameState& _oGameState)
+{
+    Solver   oSolver;
+    POSITION pos;
+
+    return oSolver.bSet_Game (_oGameState, pos) ? oSolver.ullKey (pos) : 0;
+}
+
+
+/******************************************************************************
+ *  @function   vAdd_Stats
+ *
+ *  @brief      Merges search statistics, e.g. of solvers of several
+ *              threads (one solver per thread)
+ *
+ *  @param      total : Receives the sums
+ *              stats : Statistics to add
+ *  @return     -
+ ******************************************************************************/
+
+void Solver::vAdd_Stats (SOLVE_STATS& total, const SOLVE_STATS& stats)
+{
+    total.nodes      += stats.nodes;
+    total.expanded   += stats.expanded;
+    total.children   += stats.children;
+    total.probes     += stats.probes;
+    total.hits       += stats.hits;
+    total.stores     += stats.stores;
+    total.rules      += stats.rules;
+    total.iterations += stats.iterations;
+    total.seconds    += stats.seconds;
+
+    for (short i = 0; i < BOARD_SLOTS_MAX; i++)  total.cutoffs[i] += stats.cutoffs[i];
+    for (short i = 0; i <= SOLVE_DEPTH_MAX; i++) total.depth[i]   += stats.depth[i];
+}
+
+
+/******************************************************************************
+ *  @function   sGet_Json
+ *
+ *  @brief      Returns search statistics as one line of JSON, with
+ *              effective branching factor (searched moves per position
+ *              with moves searched) and TT hit rate
+ *
+ *  @param      stats : Statistics
+ *  @return     JSON object
+ ******************************************************************************/
+
+std::string Solver::sGet_Json (const SOLVE_STATS& stats)
+{
+    std::ostringstream out;
+    short              cutoffs = BOARD_SLOTS_MAX, depth = SOLVE_DEPTH_MAX + 1;
+
+    // Trailing zero entries are left out
+    while (cutoffs > 0 && stats.cutoffs[cutoffs - 1] == 0)  cutoffs--;
+    while (depth   > 0 && stats.depth[depth - 1] == 0)      depth--;
+
+#ifdef  SEARCH_STATS
+    out << "{\"enabled\": true";
+#else
+    out << "{\"enabled\": false";
+#endif // SEARCH_STATS
+
+    out << ", \"nodes\": "      << stats.nodes
+        << ", \"expanded\": "   << stats.expanded
+        << ", \"ebf\": "        << (stats.expanded > 0 ? (double)stats.children / stats.expanded : 0)
+        << ", \"tt\": {\"probes\": " << stats.probes << ", \"hits\": " << stats.hits
+        << ", \"hit_rate\": "   << (stats.probes > 0 ? (double)stats.hits / stats.probes : 0)
+        << ", \"stores\": "     << stats.stores << "}"
+        << ", \"rules\": "      << stats.rules
+        << ", \"cutoffs\": [";
+    for (short i = 0; i < cutoffs; i++)  out << (i > 0 ? ", " : "") << stats.cutoffs[i];
+
+    out << "], \"depth\": [";
+    for (short i = 0; i < depth; i++)    out << (i > 0 ? ", " : "") << stats.depth[i];
+
+    out << "], \"iterations\": " << stats.iterations
+        << ", \"seconds\": "    << stats.seconds
+        << ", \"seconds_per_iteration\": " << (stats.iterations > 0 ? stats.seconds / stats.iterations : 0)
+        << "}";
+
+    return out.str();
+}
+
+
+/******************************************************************************
+ *  @function   bSet_Game
+ *
+ *  @brief      Takes over rules and position of a game
+ *
+ *  @param      _oGameState : Game
+ *              pos         : Receives position
+ *  @return     bool        : false  if board is not supported or a
+ *                                   token chain is on the board
+ ******************************************************************************/
+
+bool Solver::bSet_Game (const GameState& _oGameState, POSITION& pos)
+{
+    GameState::BOARD size = _oGameState.tGet_BoardSize();
+
+    if (!bSupported (size.slot, size.line)) return false;
+
+    siSlots  = size.slot;
+    siLines  = size.line;
+    siTokens = _oGameState.siGet_WinTokens();
+
+    for (short i = 0; i < siSlots; i++)  aOrder[i] = siSlots / 2 + (1 - 2 * (i % 2)) * (i + 1) / 2;
+
+    // Chains from the line table, lanes moved to the board stride
+    const LineTable::LINE* pLines = LineTable::pGet_Lines (siTokens);
+
+    vecLines.clear();
+
+    for (long i = 0; i < LineTable::liCount (siTokens); i++)
+    {
+        const LineTable::LINE& line = pLines[i];
+
+        if (!LineTable::bFits (line, siSlots, siLines)) continue;
+
+        unsigned long long cells = 0;
+
+        for (short slot = line.slot; slot < line.slots; slot++)
+        {
+            unsigned long long lane = line.cells.word[slot * PACKED_LANE_BITS / 64] >> (slot * PACKED_LANE_BITS % 64);
+
+            cells |= (lane & ((1ULL << PACKED_LANE_BITS) - 1)) << (slot * (siLines + 1));
+        }
+        vecLines.push_back (cells);
+    }
+
+    pos.current = pos.mask = 0;
+    pos.moves   = _oGameState.siGet_MoveCount();
+
+    unsigned long long other = 0;
+
+    for (short slot = 0; slot < siSlots; slot++)
+    {
+        for (short line = 0; line < _oGameState.siGet_SlotHeight (slot + 1); line++)
+        {
+            unsigned long long bit = 1ULL << (slot * (siLines + 1) + line);
+
+            // Lines of the game state are counted from top
+            if (_oGameState.siGet_Field ({slot, (short)(siLines - 1 - line)}) == _oGameState.siGet_CurrentPlayer())
+                pos.current |= bit;
+            else
+                other |= bit;
+
+            pos.mask |= bit;
+        }
+    }
+    return !bHas_Chain (pos.current) && !bHas_Chain (other);
+}
+
+
+/******************************************************************************
+ *  @function   siNegamax
+ *
+ *  @brief      Alpha-beta search:
+ *              * A move completing a chain wins at once
+ *              * Two threats of the opponent lose, one must be blocked
+ *              * Table entries and rules narrow the window, other
+ *                moves are searched center first
+ *              * Results replace the newest entry of their bucket or
+ *                the entry of a smaller search
+ *
+ *  @param      pos         : Position without token chain
+ *              alpha, beta : Search window (SOLVE_LOSS ... SOLVE_WIN)
+ *  @return     Value for side to move (exact within the window)
+ ******************************************************************************/
+
+short Solver::siNegamax (const POSITION& pos, short alpha, short beta)
+{
+    const short cells = siSlots * siLines;
+
+    llNodes++;
+    STATS (tStats.nodes++;  tStats.depth[pos.moves - siRoot]++);
+
+    if ((llNodes & (SOLVE_CHECK_NODES - 1)) == 0 && !sCheckpoint.empty()) vCheckpoint();
+
+    if (pos.moves == cells) return SOLVE_DRAW;
+
+    for (short slot = 0; slot < siSlots; slot++)
+        if (bCan_Play (pos, slot) && bWins (pos, slot)) return SOLVE_WIN;
+
+    if (pos.moves + 1 == cells) return SOLVE_DRAW;      // Last move does not win
+
+    POSITION opponent = {pos.current ^ pos.mask, pos.mask, pos.moves};
+    short    forced = -1, threats = 0;
+
+    for (short slot = 0; slot < siSlots; slot++)
+        if (bCan_Play (pos, slot) && bWins (opponent, slot)) {forced = slot;  threats++;}
+
+    if (threats > 1) return SOLVE_LOSS;
+
+    unsigned long long key    = ullKey (pos);
+    TABLE_ENTRY*       bucket = &vecTable[((key * 0x9E3779B97F4A7C15ULL) >> (64 - siTableBits)) & ~1ULL];
+
+    STATS (tStats.probes++);
+
+    for (short i = 0; i < 2; i++)
+    {
+        const TABLE_ENTRY& entry = bucket[i];
+
+        if (entry.key != key) continue;
+
+        STATS (tStats.hits++);
+
+        if (entry.bound == BOUND_EXACT) return entry.value;
+        if (entry.bound == BOUND_LOWER) alpha = std::max (alpha, (short)entry.value);
+        if (entry.bound == BOUND_UPPER) beta  = std::min (beta,  (short)entry.value);
+        if (alpha >= beta) return entry.value;
+    }
+
+    if (bRules)
+    {
+        short bound = siRules (pos);
+
+        if (bound == SOLVE_LOSS) {STATS (tStats.rules++);  return SOLVE_LOSS;}
+        if (bound < beta)  beta = bound;
+        if (alpha >= beta) {STATS (tStats.rules++);  return beta;}
+    }
+
+    short     alpha_start = alpha, best = SOLVE_LOSS;
+    long long nodes       = llNodes;
+
+    STATS (tStats.expanded++);
+
+    for (short i = 0; i < siSlots; i++)
+    {
+        short slot = (forced >= 0) ? forced : aOrder[i];
+
+        if (bCan_Play (pos, slot))
+        {
+            POSITION child = pos;
+
+            vPlay (child, slot);
+            STATS (tStats.children++);
+
+            short value = -siNegamax (child, -beta, -alpha);
+
+            if (value > best)  best  = value;
+            if (value > alpha) alpha = value;
+            if (alpha >= beta) {STATS (tStats.cutoffs[i]++);  break;}
+        }
+        if (forced >= 0) break;
+    }
+
+    unsigned char work = 0;
+
+    for (nodes = llNodes - nodes; nodes > 1; nodes >>= 1)  work++;
+
+    // First entry of a bucket is kept for larger searches
+    TABLE_ENTRY* store = (bucket[0].key == key || work >= bucket[0].work) ? &bucket[0] : &bucket[1];
+
+    if (store == &bucket[0] && bucket[1].key == key) bucket[1].key = ~0ULL;     // No stale twin
+
+    store->key   = key;
+    store->value = best;
+    store->bound = (best <= alpha_start) ? BOUND_UPPER : (best >= beta) ? BOUND_LOWER : BOUND_EXACT;
+    store->work  = work;
+    STATS (tStats.stores++);
+
+    return best;
+}
+
+
+/******************************************************************************
+ *  @function   vCheckpoint
+ *
+ *  @brief      Saves the table if the checkpoint interval is over
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void Solver::vCheckpoint()
+{
+    auto tNow = std::chrono::steady_clock::now();
+
+    if (tNow < tNextSave) return;
+
+    bSave_Table (sCheckpoint);
+
+    tNextSave  = std::chrono::steady_clock::now();
+    dSaveTime += std::chrono::duration<double> (tNextSave - tNow).count();
+    tNextSave += tInterval;
+}
+
+
+/******************************************************************************
+ *  @function   bCan_Play
+ *
+ *  @brief      Checks if a slot has a free line
+ *
+ *  @param      pos  : Position
+ *              slot : Slot index (0 ... slots - 1)
+ *  @return     bool : true  if top line of slot is empty
+ ******************************************************************************/
+
+bool Solver::bCan_Play (const POSITION& pos, short slot) const
+{
+    return (pos.mask & 1ULL << (slot * (siLines + 1) + siLines - 1)) == 0;
+}
+
+
+/******************************************************************************
+ *  @function   bWins
+ *
+ *  @brief      Checks if a move of the side to move completes a chain
+ *
+ *  @param      pos  : Position
+ *              slot : Slot index of a free slot
+ *  @return     bool : true  if move wins
+ ******************************************************************************/
+
+bool Solver::bWins (const POSITION& pos, short slot) const
+{
+    unsigned long long column = ((1ULL << siLines) - 1) << (slot * (siLines + 1));
+    unsigned long long token  = (pos.mask + (1ULL << (slot * (siLines + 1)))) & column;
+
+    return bHas_Chain (pos.current | token);
+}
+
+
+/******************************************************************************
+ *  @function   vPlay
+ *
+ *  @brief      Plays a move, the opponent becomes side to move
+ *
+ *  @param      pos  : Position, updated
+ *              slot : Slot index of a free slot
+ *  @return     -
+ ******************************************************************************/
+
+void Solver::vPlay (POSITION& pos, short slot) const
+{
+    pos.current ^= pos.mask;
+    pos.mask    |= pos.mask + (1ULL << (slot * (siLines + 1)));
+    pos.moves++;
+}
+
+
+/******************************************************************************
+ *  @function   bHas_Chain
+ *
+ *  @brief      Checks a 64 bit board for a chain of tokens to win.
+ *              The empty guard bit on top of each slot stops chains
+ *              running over slot borders.
+ *
+ *  @param      board : Tokens of one player
+ *  @return     bool  : true  if a chain is found in any direction
+ ******************************************************************************/
+
+bool Solver::bHas_Chain (unsigned long long board) const
+{
+    const short step[4] = {1, (short)(siLines + 1), siLines, (short)(siLines + 2)};
+
+    for (short dir = 0; dir < 4; dir++)
+    {
+        unsigned long long chain = board;
+
+        for (short i = 1; i < siTokens && chain != 0; i++)  chain &= board >> (step[dir] * i);
+
+        if (chain != 0) return true;
+    }
+    return false;
+}
+
+
+/******************************************************************************
+ *  @function   siRules
+ *
+ *  @brief      Bounds the value of a position by follow-up play of the
+ *              player not to move: each move of the side to move is
+ *              answered by the other cell of its pair.
+ *              * Claimeven / vertical: cells above each other form pairs,
+ *                the upper cell goes to the follower
+ *              * Baseinverse: slots with an odd number of free cells are
+ *                paired by their lowest free cells, the follower gets one
+ *              The side to move can not win if each of its chains holds
+ *              an upper cell or both cells of a base pair; it loses if
+ *              the follower gets a whole chain by upper cells (aftereven).
+ *
+ *  @param      pos : Position, side to move without immediate win
+ *  @return     SOLVE_LOSS : Side to move loses
+ *              SOLVE_DRAW : Side to move can not win
+ *              SOLVE_WIN  : No bound
+ ******************************************************************************/
+
+short Solver::siRules (const POSITION& pos) const
+{
+    const short stride = siLines + 1;
+
+    // Every move must be answered, so the side to move may not have the last move
+    if ((siSlots * siLines - pos.moves) % 2 != 0) return SOLVE_WIN;
+
+    unsigned long long other = pos.current ^ pos.mask, upper = 0, bases = 0;
+    unsigned long long odd[BOARD_SLOTS_MAX], open[SOLVE_LINES_MAX], pairs[BOARD_SLOTS_MAX / 2 + 1];
+    short              count = 0, opened = 0;
+
+    for (short slot = 0; slot < siSlots; slot++)
+    {
+        short line = 0;
+
+        while (line < siLines && (pos.mask >> (slot * stride + line) & 1) != 0)  line++;
+
+        if ((siLines - line) % 2 != 0)
+        {
+            odd[count++] = 1ULL << (slot * stride + line);
+            bases       |= odd[count - 1];
+            line++;
+        }
+        for (line++; line < siLines; line += 2)  upper |= 1ULL << (slot * stride + line);
+    }
+
+    for (unsigned long long cells : vecLines)
+    {
+        if ((cells & other) != 0 || (cells & upper) != 0) continue;
+
+        // Chain needs two base cells to be refuted by a base pair
+        unsigned long long free_bases = cells & bases;
+
+        if ((free_bases & (free_bases - 1)) == 0) return SOLVE_WIN;
+
+        open[opened++] = cells;
+    }
+
+    if (opened > 0 && !bPair_Bases (odd, count, pairs, 0, open, opened)) return SOLVE_WIN;
+
+    for (unsigned long long cells : vecLines)
+    {
+        if ((cells & pos.current) == 0 && (cells & ~(other | upper)) == 0) return SOLVE_LOSS;
+    }
+    return SOLVE_DRAW;
+}
+
+
+/******************************************************************************
+ *  @function   bPair_Bases
+ *
+ *  @brief      Tries all pairings of base cells for one refuting all open
+ *              chains of the side to move
+ *
+ *  @param      odd    : Base cells not paired yet, order is changed
+ *                       meanwhile
+ *              count  : Number of base cells (even)
+ *              pairs  : Cells of base pairs
+ *              paired : Number of base pairs
+ *              open   : Chains not refuted by upper cells
+ *              opened : Number of open chains
+ *  @return     bool   : true  if all open chains hold a base pair
+ ******************************************************************************/
+
+bool Solver::bPair_Bases (unsigned long long* odd, short count,
+                          unsigned long long* pairs, short paired,
+                          const unsigned long long* open, short opened) const
+{
+    if (count == 0)
+    {
+        for (short i = 0; i < opened; i++)
+        {
+            short pair = 0;
+
+            while (pair < paired && (open[i] & pairs[pair]) != pairs[pair])  pair++;
+
+            if (pair == paired) return false;
+        }
+        return true;
+    }
+
+    for (short i = 1; i < count; i++)
+    {
+        pairs[paired] = odd[0] | odd[i];
+
+        // Remaining cells are odd[1] ... odd[count - 2]
+        std::swap (odd[i], odd[count - 1]);
+
+        bool refuted = bPair_Bases (odd + 1, count - 2, pairs, paired + 1, open, opened);
+
+        std::swap (odd[i], odd[count - 1]);
+
+        if (refuted) return true;
+    }
+    return false;
+}
+
+
+/******************************************************************************
+ *  @function   ullKey
+ *
+ *  @brief      Unique key of a position (tokens of side to move plus all
+ *              tokens stay within the bits of each slot), the smaller one
+ *              of position and mirror image
+ *
+ *  @param      pos : Position
+ *  @return     Key
+ ******************************************************************************/
+
+unsigned long long Solver::ullKey (const POSITION& pos) const
+{
+    unsigned long long key = pos.current + pos.mask;
+
+    return std::min (key, ullMirror (key, siSlots, siLines));
+}
+
+
+/******************************************************************************
+ *  @function   ullMirror
+ *
+ *  @brief      Reverses the order of slots of a 64 bit board
+ *
+ *  @param      key          : Board
+ *              slots, lines : Board size
+ *  @return     Mirrored board
+ ******************************************************************************/
+
+unsigned long long Solver::ullMirror (unsigned long long key, short slots, short lines)
+{
+    const unsigned long long LANE = (1ULL << (lines + 1)) - 1;
+
+    unsigned long long mirror = 0;
+
+    for (short slot = 0; slot < slots; slot++)
+        mirror |= (key >> (slot * (lines + 1)) & LANE) << ((slots - 1 - slot) * (lines + 1));
+
+    return mirror;
+}
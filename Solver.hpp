@@ -0,0 +1,180 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Solver.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   Solver
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _SOLVER_H_
+#define _SOLVER_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <chrono>
+#include <string>
+#include <vector>
+
+/*------  Module header includes  -------*/
+#include "GameState.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Results, seen by side to move  ***/
+#define SOLVE_LOSS          -1
+#define SOLVE_DRAW          0
+#define SOLVE_WIN           1
+#define SOLVE_UNKNOWN       2       // Board not supported or game over
+
+/***  Transposition table  ***/
+#define SOLVE_TABLE_BITS    22      // 2^22 entries, 16 bytes each, two per bucket
+
+/***  Chains of a 64 bit board, 4 directions per cell  ***/
+#define SOLVE_LINES_MAX     (4 * 64)
+
+/***  Checkpoint file layout  ***
+ *
+ *  CHECKPOINT_HEADER
+ *  Entries : Transposition table as in memory (2^bits entries, 16 bytes)
+ *  All values in host byte order (little endian).
+ */
+#define SOLVE_MAGIC         "CF4S"
+#define SOLVE_VERSION       1
+#define SOLVE_CHECK_NODES   (1 << 20)   // Positions between checks of the clock
+
+/***  Search statistics (SEARCH_STATS in main.hpp)  ***/
+#define SOLVE_DEPTH_MAX     64          // Cells of a 64 bit board
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Weak solver: finds win, draw or loss of a position by alpha-beta
+ *  search over 64 bit boards (slots are lines + 1 bits apart). Known
+ *  positions are kept in a transposition table under the smaller key
+ *  of position and mirror image. Each bucket keeps the entry of the
+ *  largest search beside the newest one, so results near the root
+ *  survive in the table and in checkpoints. Optionally, rules of
+ *  follow-up play (claimeven, vertical, baseinverse, aftereven) prove
+ *  draws and losses without search.                                   */
+
+class Solver
+{
+    public:
+    /** Types / Structs **/
+        typedef struct
+        {
+            unsigned long long  current;    // Tokens of side to move
+            unsigned long long  mask;       // All tokens
+            short               moves;
+        } POSITION;
+
+        typedef struct
+        {
+            long long   nodes;                          // Positions searched
+            long long   expanded, children;             // Positions with moves searched, their moves
+            long long   probes, hits, stores;           // Transposition table
+            long long   rules;                          // Positions decided by rules
+            long long   cutoffs [BOARD_SLOTS_MAX];      // Per index of move in order
+            long long   depth   [SOLVE_DEPTH_MAX + 1];  // Positions per moves below root
+            long        iterations;                     // Searches from the root
+            double      seconds;
+        } SOLVE_STATS;
+
+    /** Constructor / Destructor **/
+                 Solver();
+        virtual ~Solver();
+
+    /** Getter / Setter **/
+        long long   llGet_Nodes     () const;
+        double      dGet_SaveTime   () const;
+        void        vSet_TableBits  (short bits);
+        void        vSet_Rules      (bool rules);
+        void        vSet_Checkpoint (const std::string& path, short seconds);
+        const SOLVE_STATS& tGet_Stats () const;
+        void        vReset_Stats    ();
+
+    /** Member functions / methods **/
+        virtual short   siSolve     (const GameState& _oGameState);
+        bool            bSave_Table (const std::string& path) const;
+        bool            bLoad_Table (const std::string& path);
+
+        static bool                 bSupported  (short slots, short lines);
+        static unsigned long long   ullGet_Key  (const GameState& _oGameState);
+        static void                 vAdd_Stats  (SOLVE_STATS& total, const SOLVE_STATS& stats);
+        static std::string          sGet_Json   (const SOLVE_STATS& stats);
+
+    protected:
+    /** Member functions / methods **/
+        bool    bSet_Game       (const GameState& _oGameState, POSITION& pos);
+        short   siNegamax       (const POSITION& pos, short alpha, short beta);
+
+        bool    bCan_Play       (const POSITION& pos, short slot) const;
+        bool    bWins           (const POSITION& pos, short slot) const;
+        void    vPlay           (POSITION& pos, short slot) const;
+        bool    bHas_Chain      (unsigned long long board) const;
+        unsigned long long ullKey (const POSITION& pos) const;
+
+        short   siRules         (const POSITION& pos) const;
+        bool    bPair_Bases     (unsigned long long* odd, short count,
+                                 unsigned long long* pairs, short paired,
+                                 const unsigned long long* open, short opened) const;
+
+    /** Variables **/
+        short               siSlots, siLines, siTokens;
+        short               siRoot;                     // Moves of searched position
+        short               aOrder[BOARD_SLOTS_MAX];    // Center slots first
+        long long           llNodes;
+        mutable SOLVE_STATS tStats;
+
+        bool                bRules;         // Rules bound the search
+        std::vector<unsigned long long> vecLines;   // Cells of all chains
+
+    private:
+    /** Types / Structs **/
+        typedef struct
+        {
+            unsigned long long  key;
+            signed char         value;
+            unsigned char       bound;      // Exact, lower or upper
+            unsigned char       work;       // Log2 of searched positions
+        } TABLE_ENTRY;
+
+        typedef struct
+        {
+            char                magic[4];
+            unsigned int        version;
+            short               slots, lines, tokens, bits;
+            unsigned long long  entries;
+        } CHECKPOINT_HEADER;
+
+    /** Variables **/
+        std::vector<TABLE_ENTRY>    vecTable;
+        short                       siTableBits;
+
+        std::string                 sCheckpoint;    // Empty if no checkpoints
+        std::chrono::seconds        tInterval;
+        std::chrono::steady_clock::time_point tNextSave;
+        double                      dSaveTime;
+
+    /** Member functions / methods **/
+        void    vCheckpoint     ();
+        static unsigned long long ullMirror (unsigned long long key, short slots, short lines);
+};
+
+#endif // _SOLVER_H_
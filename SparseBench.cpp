@@ -0,0 +1,188 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    SparseBench.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Sparse board benchmark
+ *           Reports time per move and undo of the sparse board for
+ *           board sizes up to 4096x4096, and errors of its winners.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::max
+#include <chrono>       // steady_clock
+#include <iostream>
+#include <vector>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "SparseBench.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class SparseBench
+ *
+ *  @brief      Instantiates a SparseBench object
+ *  @param      -
+ ******************************************************************************/
+
+SparseBench::SparseBench()
+{
+    DEBUG_CONSTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class SparseBench
+ *
+ *  @brief      Destroys this SparseBench object
+ ******************************************************************************/
+
+SparseBench::~SparseBench()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   vRun
+ *
+ *  @brief      Runs the benchmark for a set of board sizes and win tokens
+ *              and prints one result line each
+ *
+ *  @param      games : Number of games per configuration
+ *  @return     -
+ ******************************************************************************/
+
+void SparseBench::vRun (long games)
+{
+    static const int configs[5][3] = {{7, 6, 4}, {15, 15, 5}, {64, 64, 5}, {1024, 1024, 5}, {4096, 4096, 6}};
+
+    for (const auto& config : configs)  vRun_Config (config[0], config[1], config[2], games);
+}
+
+
+/******************************************************************************
+ *  @function   vRun_Config
+ *
+ *  @brief      Plays random games on one configuration, takes them back,
+ *              replays them with each move taken back once and prints
+ *              the results
+ *
+ *  @param      slots, lines : Board size
+ *              tokens       : Win tokens
+ *              games        : Number of games
+ *  @return     -
+ ******************************************************************************/
+
+void SparseBench::vRun_Config (int slots, int lines, short tokens, long games)
+{
+    Player::RandomNr oRandomNr;
+    SparseBoard      oBoard;
+    GameState        oGameState;
+    long             moves = 0, tokens_max = 0, errors = 0;
+    bool             scan  = slots <= BOARD_SLOTS_MAX && lines <= BOARD_LINES_MAX;
+    double           dTime = 0;
+
+    oRandomNr.vSet_Seed (BENCH_SEED);
+    oBoard.bSet_Board (slots, lines, tokens);
+    if (scan)
+    {
+        oGameState.vSet_BoardSize  ({(short)slots, (short)lines});
+        oGameState.vSet_WinTokens  (tokens);
+    }
+
+    for (long game = 0; game < games; game++)
+    {
+        std::vector<int> vecMoves;
+
+        // Random slots, full slots are drawn again before timing
+        while (oBoard.siGet_Winner() == 0 && oBoard.liGet_Tokens() < (long)slots * lines)
+        {
+            int slot = oRandomNr.iRndNum (1, slots);
+
+            if (oBoard.iGet_SlotHeight (slot) >= lines) continue;
+
+            vecMoves.push_back (slot);
+
+            auto tStart = std::chrono::steady_clock::now();
+
+            oBoard.bPlay_Move (slot);
+            dTime += std::chrono::duration<double> (std::chrono::steady_clock::now() - tStart).count();
+        }
+        moves     += vecMoves.size();
+        tokens_max = std::max (tokens_max, oBoard.liGet_Tokens());
+
+        auto tStart = std::chrono::steady_clock::now();
+
+        while (oBoard.bUndo_Move());
+        dTime += std::chrono::duration<double> (std::chrono::steady_clock::now() - tStart).count();
+
+        if (oBoard.liGet_Tokens() != 0 || oBoard.iGet_SlotHeight (vecMoves.front()) != 0) errors++;
+
+        // Same game again with each move taken back once, winner
+        // checked on the fields and by the game state
+        oGameState.vReset();
+        for (int slot : vecMoves)
+        {
+            oBoard.bPlay_Move (slot);
+            oBoard.bUndo_Move();
+            oBoard.bPlay_Move (slot);
+
+            bool won = siChain (oBoard, slot - 1, oBoard.iGet_SlotHeight (slot) - 1) >= tokens;
+
+            if (won != (oBoard.siGet_Winner() != 0)) errors++;
+            if (scan && oGameState.bPlay_Move (slot) && (oGameState.siCheck_WinState() != 0) != won) errors++;
+        }
+        oBoard.vReset();
+    }
+
+    std::cout << "  " << slots << "x" << lines << "x" << tokens << " : "
+              << moves << " moves, up to " << tokens_max << " tokens, "
+              << dTime * 1e9 / moves << " ns per move (with undo), "
+              << errors << " errors" << std::endl;
+}
+
+
+/******************************************************************************
+ *  @function   siChain
+ *
+ *  @brief      Longest chain through a cell in any direction, counted on
+ *              the fields
+ *
+ *  @param      board      : Sparse board
+ *              slot, line : Cell (indexes, lines from bottom)
+ *  @return     Number of tokens of the chain
+ ******************************************************************************/
+
+short SparseBench::siChain (const SparseBoard& board, int slot, int line)
+{
+    static const int step[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+
+    short player = board.siGet_Field (slot, line), longest = 0;
+
+    for (const auto& dir : step)
+    {
+        short chain = 1;
+
+        for (int sign = -1; sign <= 1; sign += 2)
+            for (int i = 1; board.siGet_Field (slot + sign * i * dir[0], line + sign * i * dir[1]) == player; i++)
+                chain++;
+
+        longest = std::max (longest, chain);
+    }
+    return longest;
+}
@@ -0,0 +1,58 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    SparseBench.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   SparseBench
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _SPARSEBENCH_H_
+#define _SPARSEBENCH_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  Module header includes  -------*/
+#include "SparseBoard.hpp"
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Sparse board benchmark. Plays random games on boards up to
+ *  4096x4096 and takes them back. Each game is replayed with every
+ *  move taken back once, winners checked against the longest chain
+ *  counted on the fields and, where it holds the board, against the
+ *  game state.                                                        */
+
+class SparseBench
+{
+    public:
+    /** Constructor / Destructor **/
+                 SparseBench();
+        virtual ~SparseBench();
+
+    /** Member functions / methods **/
+        virtual void    vRun        (long games);
+
+    protected:
+    /** Member functions / methods **/
+        virtual void    vRun_Config (int slots, int lines, short tokens, long games);
+
+    private:
+    /** Member functions / methods **/
+        static short    siChain     (const SparseBoard& board, int slot, int line);
+};
+
+#endif // _SPARSEBENCH_H_
@@ -0,0 +1,336 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    SparseBoard.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Sparse board
+ *           Tokens of large boards stored by cell, with chain lengths
+ *           kept at chain ends for win checks at the last move.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "SparseBoard.hpp"
+
+/*=============================================================================
+=====                          STATIC VARIABLES                           =====
+=============================================================================*/
+
+/***  Steps up, to the right, diagonally up and down to the right  ***/
+static const int STEP[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class SparseBoard
+ *
+ *  @brief      Instantiates an empty SparseBoard object of standard size
+ *  @param      -
+ ******************************************************************************/
+
+SparseBoard::SparseBoard()
+{
+    DEBUG_CONSTRUCTOR;
+
+    bSet_Board (BOARD_SLOTS, BOARD_LINES, WIN_TOKENS);
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class SparseBoard
+ *
+ *  @brief      Destroys this SparseBoard object
+ ******************************************************************************/
+
+SparseBoard::~SparseBoard()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   iGet_Slots, iGet_Lines, siGet_WinTokens
+ *
+ *  @brief      Returns board size and tokens to win
+ *  @param      -
+ *  @return     Slots, lines, win tokens
+ ******************************************************************************/
+
+int SparseBoard::iGet_Slots() const
+{
+    return iSlots;
+}
+
+int SparseBoard::iGet_Lines() const
+{
+    return iLines;
+}
+
+short SparseBoard::siGet_WinTokens() const
+{
+    return siTokens;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Field
+ *
+ *  @brief      Returns the owner of a cell
+ *
+ *  @param      slot, line : Cell (indexes, lines from bottom)
+ *  @return     FIELDVAL_EMPTY, PLAYER_1_ID or PLAYER_2_ID
+ ******************************************************************************/
+
+short SparseBoard::siGet_Field (int slot, int line) const
+{
+    if (slot < 0 || slot >= iSlots || line < 0 || line >= iLines) return FIELDVAL_EMPTY;
+
+    auto cell = mapCells.find (ullKey (slot, line));
+
+    return cell == mapCells.end() ? FIELDVAL_EMPTY : cell->second.owner;
+}
+
+
+/******************************************************************************
+ *  @function   iGet_SlotHeight
+ *
+ *  @brief      Returns the number of tokens in a slot
+ *
+ *  @param      slot : Slot number (1 ... slots)
+ *  @return     Tokens, zero if slot is invalid
+ ******************************************************************************/
+
+int SparseBoard::iGet_SlotHeight (int slot) const
+{
+    auto height = mapHeight.find (slot - 1);
+
+    return height == mapHeight.end() ? 0 : height->second;
+}
+
+
+/******************************************************************************
+ *  @function   liGet_Tokens
+ *
+ *  @brief      Returns the number of tokens on the board
+ *  @param      -
+ *  @return     Tokens
+ ******************************************************************************/
+
+long SparseBoard::liGet_Tokens() const
+{
+    return vecMoves.size();
+}
+
+
+/******************************************************************************
+ *  @function   siGet_CurrentPlayer
+ *
+ *  @brief      Returns the player to move, player 1 starts
+ *  @param      -
+ *  @return     PLAYER_1_ID or PLAYER_2_ID
+ ******************************************************************************/
+
+short SparseBoard::siGet_CurrentPlayer() const
+{
+    return vecMoves.size() % 2 == 0 ? PLAYER_1_ID : PLAYER_2_ID;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Winner
+ *
+ *  @brief      Returns the player who completed a chain
+ *  @param      -
+ *  @return     PLAYER_1_ID, PLAYER_2_ID, zero if no chain is completed
+ ******************************************************************************/
+
+short SparseBoard::siGet_Winner() const
+{
+    return siWinner;
+}
+
+
+/******************************************************************************
+ *  @function   bSet_Board
+ *
+ *  @brief      Sets board size and tokens to win, empties the board
+ *
+ *  @param      slots, lines : BOARD_SLOTS_MIN / BOARD_LINES_MIN ...
+ *                             SPARSE_SIZE_MAX
+ *              tokens       : WIN_TOKENS_MIN ... smaller board side
+ *  @return     bool         : false  if out of range (board unchanged)
+ ******************************************************************************/
+
+bool SparseBoard::bSet_Board (int slots, int lines, short tokens)
+{
+    if (slots < BOARD_SLOTS_MIN || slots > SPARSE_SIZE_MAX ||
+        lines < BOARD_LINES_MIN || lines > SPARSE_SIZE_MAX ||
+        tokens < WIN_TOKENS_MIN || tokens > slots || tokens > lines) return false;
+
+    iSlots   = slots;
+    iLines   = lines;
+    siTokens = tokens;
+    vReset();
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   vReset
+ *
+ *  @brief      Takes all tokens from the board
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+void SparseBoard::vReset()
+{
+    mapCells.clear();
+    mapHeight.clear();
+    vecMoves.clear();
+    siWinner = 0;
+}
+
+
+/******************************************************************************
+ *  @function   bCan_Play
+ *
+ *  @brief      Checks whether a token can be put into a slot
+ *
+ *  @param      slot : Slot number (1 ... slots)
+ *  @return     bool : false  if slot is invalid or full, or game is won
+ ******************************************************************************/
+
+bool SparseBoard::bCan_Play (int slot) const
+{
+    return siWinner == 0 && slot >= 1 && slot <= iSlots && iGet_SlotHeight (slot) < iLines;
+}
+
+
+/******************************************************************************
+ *  @function   bPlay_Move
+ *
+ *  @brief      Puts a token of the player to move into a slot and joins
+ *              it with the chains of the player ending next to it
+ *
+ *  @param      slot : Slot number (1 ... slots)
+ *  @return     bool : false  if move is not possible
+ ******************************************************************************/
+
+bool SparseBoard::bPlay_Move (int slot)
+{
+    if (!bCan_Play (slot)) return false;
+
+    const short player = siGet_CurrentPlayer();
+    const int   line   = mapHeight[--slot]++;
+
+    MOVE  move;
+    CELL& cell = mapCells[ullKey (slot, line)];
+
+    move.slot  = slot;
+    cell.owner = player;
+
+    for (short dir = 0; dir < 4; dir++)
+    {
+        CELL* back  = pFind (slot - STEP[dir][0], line - STEP[dir][1]);
+        CELL* ahead = pFind (slot + STEP[dir][0], line + STEP[dir][1]);
+
+        // Neighbours are chain ends, as this cell was free
+        move.back[dir]  = (back  != NULL && back->owner  == player) ? back->run[dir]  : 0;
+        move.ahead[dir] = (ahead != NULL && ahead->owner == player) ? ahead->run[dir] : 0;
+
+        const int run = move.back[dir] + move.ahead[dir] + 1;
+
+        cell.run[dir] = run;
+        if (move.back[dir] > 0)
+            pFind (slot - STEP[dir][0] * move.back[dir], line - STEP[dir][1] * move.back[dir])->run[dir] = run;
+        if (move.ahead[dir] > 0)
+            pFind (slot + STEP[dir][0] * move.ahead[dir], line + STEP[dir][1] * move.ahead[dir])->run[dir] = run;
+
+        if (run >= siTokens) siWinner = player;
+    }
+    vecMoves.push_back (move);
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   bUndo_Move
+ *
+ *  @brief      Takes back the last move, splitting the joined chains
+ *  @param      -
+ *  @return     bool : false  if board is empty
+ ******************************************************************************/
+
+bool SparseBoard::bUndo_Move()
+{
+    if (vecMoves.empty()) return false;
+
+    const MOVE& move   = vecMoves.back();
+    auto        height = mapHeight.find (move.slot);
+    const int   slot   = move.slot;
+    const int   line   = --height->second;
+
+    if (line == 0) mapHeight.erase (height);
+
+    for (short dir = 0; dir < 4; dir++)
+    {
+        if (move.back[dir] > 0)
+            pFind (slot - STEP[dir][0] * move.back[dir], line - STEP[dir][1] * move.back[dir])->run[dir] = move.back[dir];
+        if (move.ahead[dir] > 0)
+            pFind (slot + STEP[dir][0] * move.ahead[dir], line + STEP[dir][1] * move.ahead[dir])->run[dir] = move.ahead[dir];
+    }
+    mapCells.erase (ullKey (slot, line));
+    vecMoves.pop_back();
+    siWinner = 0;           // No move is played after a win
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   pFind
+ *
+ *  @brief      Returns the token of a cell
+ *
+ *  @param      slot, line : Cell (indexes, lines from bottom)
+ *  @return     Token, NULL if cell is free or outside the board
+ ******************************************************************************/
+
+SparseBoard::CELL* SparseBoard::pFind (int slot, int line)
+{
+    if (slot < 0 || slot >= iSlots || line < 0 || line >= iLines) return NULL;
+
+    auto cell = mapCells.find (ullKey (slot, line));
+
+    return cell == mapCells.end() ? NULL : &cell->second;
+}
+
+
+/******************************************************************************
+ *  @function   ullKey
+ *
+ *  @brief      Returns the hash key of a cell
+ *
+ *  @param      slot, line : Cell (indexes)
+ *  @return     Key
+ ******************************************************************************/
+
+unsigned long long SparseBoard::ullKey (int slot, int line)
+{
+    return (unsigned long long)slot << 32 | (unsigned int)line;
+}
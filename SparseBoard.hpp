@@ -0,0 +1,106 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    SparseBoard.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   SparseBoard
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _SPARSEBOARD_H_
+#define _SPARSEBOARD_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <unordered_map>
+#include <vector>
+
+/*------  Module header includes  -------*/
+#include "GameState.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Largest board side  ***/
+#define SPARSE_SIZE_MAX     (1 << 24)
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Board of any size beyond the limits of GameState. Only placed
+ *  tokens and heights of slots holding tokens are stored (hashed by
+ *  cell), so memory and time per move depend on the tokens, not on the
+ *  board area. Every token knows the length of its chain per direction,
+ *  valid at both ends of the chain: a move joins the chains ending next
+ *  to it in constant time and is a win if one reaches the win tokens.
+ *  Moves are taken back in reverse order only.                       */
+
+class SparseBoard
+{
+    public:
+    /** Constructor / Destructor **/
+                 SparseBoard();
+        virtual ~SparseBoard();
+
+    /** Getter / Setter **/
+        int     iGet_Slots          () const;
+        int     iGet_Lines          () const;
+        short   siGet_WinTokens     () const;
+        short   siGet_Field         (int slot, int line) const;
+        int     iGet_SlotHeight     (int slot) const;
+        long    liGet_Tokens        () const;
+        short   siGet_CurrentPlayer () const;
+        short   siGet_Winner        () const;
+
+        bool    bSet_Board          (int slots, int lines, short tokens);
+
+    /** Member functions / methods **/
+        void    vReset              ();     // Empty board, player 1 to move
+        bool    bCan_Play           (int slot) const;
+        bool    bPlay_Move          (int slot);
+        bool    bUndo_Move          ();
+
+    private:
+    /** Types / Structs **/
+        typedef struct
+        {
+            unsigned char   owner;
+            int             run[4];         // Chain length, valid at chain ends
+        } CELL;
+
+        typedef struct
+        {
+            int             slot;
+            int             back[4];        // Lengths of joined chains
+            int             ahead[4];
+        } MOVE;
+
+    /** Variables **/
+        int                 iSlots, iLines;
+        short               siTokens;
+        short               siWinner;
+
+        std::unordered_map<unsigned long long, CELL>    mapCells;   // Tokens by cell
+        std::unordered_map<int, int>                    mapHeight;  // Tokens per slot
+        std::vector<MOVE>                               vecMoves;
+
+    /** Member functions / methods **/
+        CELL*   pFind           (int slot, int line);
+        static unsigned long long ullKey (int slot, int line);
+};
+
+#endif // _SPARSEBOARD_H_
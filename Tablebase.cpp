@@ -0,0 +1,699 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Tablebase.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Retrograde tablebase
+ *           Solves all positions of small boards backwards, writes them
+ *           as mappable table and gives perfect moves from it.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::min
+#include <atomic>
+#include <cstring>      // std::memcpy, std::memcmp
+#include <fstream>
+#include <map>
+#include <memory>       // std::unique_ptr
+#include <mutex>
+#include <thread>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "Tablebase.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Most cells of a supported board (cell mask is 32 bit)  ***/
+#define TABLE_CELLS_MAX     32
+
+/*=============================================================================
+=====                           LOCAL FUNCTIONS                           =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   ullBinomial
+ *
+ *  @brief      Binomial coefficient n over k from a table built on first use
+ *
+ *  @param      n, k : 0 ... TABLE_CELLS_MAX
+ *  @return     n over k, zero if k > n
+ ******************************************************************************/
+
+static unsigned long long ullBinomial (short n, short k)
+{
+    static const struct TABLE
+    {
+        unsigned long long value[TABLE_CELLS_MAX + 1][TABLE_CELLS_MAX + 1];
+
+        TABLE()
+        {
+            std::memset (value, 0, sizeof(value));
+
+            for (short i = 0; i <= TABLE_CELLS_MAX; i++)
+            {
+                value[i][0] = 1;
+                for (short j = 1; j <= i; j++)  value[i][j] = value[i - 1][j - 1] + value[i - 1][j];
+            }
+        }
+    } oTable;
+
+    return oTable.value[n][k];
+}
+
+
+/******************************************************************************
+ *  @function   ullRank
+ *
+ *  @brief      Colex rank of a set of cells among all sets of same size
+ *
+ *  @param      mask : Set bit per cell in set
+ *  @return     Rank (0 = lowest cells)
+ ******************************************************************************/
+
+static unsigned long long ullRank (unsigned int mask)
+{
+    unsigned long long rank = 0;
+
+    for (short i = 1; mask != 0; i++, mask &= mask - 1)
+        rank += ullBinomial (__builtin_ctz (mask), i);
+
+    return rank;
+}
+
+/*=============================================================================
+=====                          STATIC VARIABLES                           =====
+=============================================================================*/
+
+std::string Tablebase::sDirectory = TABLE_DIRECTORY;
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class Tablebase
+ *
+ *  @brief      Instantiates a Tablebase object without table,
+ *              one thread per core for generation
+ *  @param      -
+ ******************************************************************************/
+
+Tablebase::Tablebase()
+{
+    DEBUG_CONSTRUCTOR;
+
+    siSlots = siLines = siTokens = 0;
+    ullProfiles = 0;
+
+    siThreads = std::thread::hardware_concurrency();
+    if (siThreads < 1) siThreads = 1;
+
+    pOffset = NULL;
+    pValues = NULL;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class Tablebase
+ *
+ *  @brief      Destroys this Tablebase object
+ ******************************************************************************/
+
+Tablebase::~Tablebase()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   ullGet_Entries
+ *
+ *  @brief      Returns number of entries (including alignment)
+ *  @param      -
+ *  @return     Entries, zero without table
+ ******************************************************************************/
+
+unsigned long long Tablebase::ullGet_Entries() const
+{
+    return pOffset != NULL ? pOffset[ullProfiles] : 0;
+}
+
+
+/******************************************************************************
+ *  @function   tGet_Size
+ *
+ *  @brief      Returns size of table file
+ *  @param      -
+ *  @return     Number of bytes
+ ******************************************************************************/
+
+size_t Tablebase::tGet_Size() const
+{
+    return sizeof(TABLE_HEADER) + (ullProfiles + 1) * sizeof(unsigned long long) +
+           (ullGet_Entries() + 3) / 4;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Value
+ *
+ *  @brief      Returns game theoretic value of a position
+ *
+ *  @param      _oGameState : Position of a covered configuration
+ *  @return     TABLE_WIN, TABLE_DRAW, TABLE_LOSS for side to move,
+ *              TABLE_INVALID if position is not covered or game is over
+ ******************************************************************************/
+
+short Tablebase::siGet_Value (const GameState& _oGameState) const
+{
+    POSITION pos;
+
+    if (!bEncode (_oGameState, pos)) return TABLE_INVALID;
+
+    return siValue (pOffset[pos.profile] + ullRank (pos.mask));
+}
+
+
+/******************************************************************************
+ *  @function   siGet_BestMoves
+ *
+ *  @brief      Finds all moves keeping the best value of a position
+ *
+ *  @param      _oGameState : Position of a covered configuration
+ *              slots       : Receives slot numbers (1 ... slots)
+ *                            of best moves, BOARD_SLOTS_MAX at most
+ *  @return     Number of best moves, zero if position is not covered
+ ******************************************************************************/
+
+short Tablebase::siGet_BestMoves (const GameState& _oGameState, short* slots) const
+{
+    static const short RANK[4] = {0, 3, 2, 1};     // Win before draw before loss
+
+    POSITION pos;
+    short    count = 0, best = 0;
+
+    if (!bEncode (_oGameState, pos) || bHas_Chain (pos.starter) || bHas_Chain (pos.second)) return 0;
+
+    for (short slot = 0; slot < siSlots; slot++)
+    {
+        if (pos.heights[slot] == siLines) continue;
+
+        short rank = RANK[siMove_Value (pos, slot)];
+
+        if (rank > best)  {best = rank;  count = 0;}
+        if (rank == best) slots[count++] = slot + 1;
+    }
+    return count;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Threads
+ *
+ *  @brief      Sets number of generating threads
+ *
+ *  @param      _siThreads : Number of threads (at least 1)
+ *  @return     -
+ ******************************************************************************/
+
+void Tablebase::vSet_Threads (short _siThreads)
+{
+    siThreads = (_siThreads < 1) ? 1 : _siThreads;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Directory
+ *
+ *  @brief      Sets directory of table files used by pFind().
+ *              Call before the first move of a machine player.
+ *
+ *  @param      directory : Directory of table files
+ *  @return     -
+ ******************************************************************************/
+
+void Tablebase::vSet_Directory (const std::string& directory)
+{
+    sDirectory = directory;
+}
+
+
+/******************************************************************************
+ *  @function   pFind
+ *
+ *  @brief      Returns the table of a game configuration. Tables are mapped
+ *              from the table directory on first request and kept open.
+ *
+ *  @param      _oGameState : Game
+ *  @return     Table covering the game, NULL if none
+ ******************************************************************************/
+
+const Tablebase* Tablebase::pFind (const GameState& _oGameState)
+{
+    static std::mutex                                 oMutex;
+    static std::map<int, std::unique_ptr<Tablebase>>  mapTables;
+
+    GameState::BOARD size   = _oGameState.tGet_BoardSize();
+    short            tokens = _oGameState.siGet_WinTokens();
+    int              key    = size.slot << 16 | size.line << 8 | tokens;
+
+    std::lock_guard<std::mutex> oLock (oMutex);
+
+    auto it = mapTables.find (key);
+
+    if (it == mapTables.end())
+    {
+        std::unique_ptr<Tablebase> pTable (new Tablebase);
+
+        if (!bSupported (size.slot, size.line, tokens) ||
+            !pTable->bOpen (sDirectory + "/" + sFile_Name (size.slot, size.line, tokens)))
+            pTable.reset();     // Configuration is not looked up again
+
+        it = mapTables.insert (std::make_pair (key, std::move (pTable))).first;
+    }
+    return it->second.get();
+}
+
+
+/******************************************************************************
+ *  @function   bGenerate
+ *
+ *  @brief      Solves all positions of a configuration:
+ *              * Offsets of height profiles are set, each profile begins
+ *                on a byte, so threads never share a byte
+ *              * Layers are solved from full board to empty board, all
+ *                profiles of a layer in parallel; moves lead into the
+ *                solved layer above only
+ *
+ *  @param      slots, lines : Board size
+ *              tokens       : Tokens to win
+ *  @return     bool         : false  if configuration is not supported
+ ******************************************************************************/
+
+bool Tablebase::bGenerate (short slots, short lines, short tokens)
+{
+    if (!bSupported (slots, lines, tokens)) return false;
+
+    std::vector<std::vector<unsigned long long>> vecLayer (slots * lines + 1);
+
+    oFile.vClose();
+    siSlots = slots;  siLines = lines;  siTokens = tokens;
+
+    ullProfiles = 1;
+    for (short slot = 0; slot < slots; slot++)  ullProfiles *= lines + 1;
+
+    vecOffset.assign (ullProfiles + 1, 0);
+
+    for (unsigned long long profile = 0; profile < ullProfiles; profile++)
+    {
+        short n = 0;
+
+        for (unsigned long long rest = profile; rest > 0; rest /= lines + 1)  n += rest % (lines + 1);
+
+        vecLayer[n].push_back (profile);
+        vecOffset[profile + 1] = (vecOffset[profile] + ullBinomial (n, n / 2) + 3) & ~3ULL;
+    }
+
+    vecValues.assign (vecOffset[ullProfiles] / 4, 0);
+    pOffset = vecOffset.data();
+    pValues = vecValues.data();
+
+    for (short n = slots * lines; n >= 0; n--)
+    {
+        std::vector<std::thread> vecThreads;
+        std::atomic<size_t>      next (0);
+        const auto&              layer = vecLayer[n];
+
+        for (short t = 0; t < siThreads; t++)
+        {
+            vecThreads.emplace_back ([this, &next, &layer]()
+            {
+                for (size_t i = next++; i < layer.size(); i = next++)  vSolve_Profile (layer[i]);
+            });
+        }
+        for (std::thread& oThread : vecThreads)  oThread.join();
+    }
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   bWrite
+ *
+ *  @brief      Writes the generated table to a file
+ *
+ *  @param      path : Table file
+ *  @return     bool : false  if no table or file can not be written
+ ******************************************************************************/
+
+bool Tablebase::bWrite (const std::string& path) const
+{
+    if (vecValues.empty()) return false;
+
+    std::ofstream oTable (path, std::ios::binary | std::ios::trunc);
+    TABLE_HEADER  header = {};
+
+    std::memcpy (header.magic, TABLE_MAGIC, 4);
+    header.version  = TABLE_VERSION;
+    header.slots    = siSlots;  header.lines = siLines;  header.tokens = siTokens;
+    header.entries  = vecOffset[ullProfiles];
+    header.profiles = ullProfiles;
+
+    oTable.write ((const char*)&header, sizeof(header));
+    oTable.write ((const char*)vecOffset.data(), vecOffset.size() * sizeof(unsigned long long));
+    oTable.write ((const char*)vecValues.data(), vecValues.size());
+
+    return oTable.good();
+}
+
+
+/******************************************************************************
+ *  @function   bOpen
+ *
+ *  @brief      Maps a table file for lookups
+ *
+ *  @param      path : Table file
+ *  @return     bool : false  if file can not be mapped or is no table
+ ******************************************************************************/
+
+bool Tablebase::bOpen (const std::string& path)
+{
+    vecOffset.clear();  vecValues.clear();
+    pOffset = NULL;  pValues = NULL;
+
+    if (!oFile.bOpen (path, false) || oFile.tGet_Size() < sizeof(TABLE_HEADER)) return false;
+
+    const TABLE_HEADER* header = (const TABLE_HEADER*)oFile.pGet_Data();
+
+    siSlots = header->slots;  siLines = header->lines;  siTokens = header->tokens;
+    ullProfiles = header->profiles;
+
+    if (std::memcmp (header->magic, TABLE_MAGIC, 4) != 0  ||
+        header->version != TABLE_VERSION  ||
+        !bSupported (siSlots, siLines, siTokens)  ||  tGet_Size() > oFile.tGet_Size())
+    {
+        oFile.vClose();
+        return false;
+    }
+
+    pOffset = (const unsigned long long*)(header + 1);
+    pValues = (const unsigned char*)(pOffset + ullProfiles + 1);
+
+    if (ullGet_Entries() != header->entries) {oFile.vClose();  pOffset = NULL;  pValues = NULL;}
+
+    return pValues != NULL;
+}
+
+
+/******************************************************************************
+ *  @function   bCovers
+ *
+ *  @brief      Checks if the table holds the configuration of a game
+ *
+ *  @param      _oGameState : Game
+ *  @return     bool        : true  if board size and tokens to win match
+ ******************************************************************************/
+
+bool Tablebase::bCovers (const GameState& _oGameState) const
+{
+    GameState::BOARD size = _oGameState.tGet_BoardSize();
+
+    return pValues != NULL  &&  size.slot == siSlots  &&  size.line == siLines  &&
+           _oGameState.siGet_WinTokens() == siTokens;
+}
+
+
+/******************************************************************************
+ *  @function   bSupported
+ *
+ *  @brief      Checks if a configuration can be held by a table
+ *
+ *  @param      slots, lines : Board size
+ *              tokens       : Tokens to win
+ *  @return     bool         : true  if board fits into 64 bit boards with
+ *                                   guard line and table is not too large
+ ******************************************************************************/
+
+bool Tablebase::bSupported (short slots, short lines, short tokens)
+{
+    return slots  >= BOARD_SLOTS_MIN  &&  lines >= BOARD_LINES_MIN  &&
+           tokens >= WIN_TOKENS_MIN   &&  tokens <= std::min (slots, lines)  &&
+           slots * (lines + 1) <= 64  &&  slots * lines <= TABLE_CELLS_MAX  &&
+           ullCount (slots, lines) <= TABLE_ENTRIES_MAX;
+}
+
+
+/******************************************************************************
+ *  @function   sFile_Name
+ *
+ *  @brief      Returns file name of a table, e.g. "5x4_4.cf4t"
+ *
+ *  @param      slots, lines : Board size
+ *              tokens       : Tokens to win
+ *  @return     File name
+ ******************************************************************************/
+
+std::string Tablebase::sFile_Name (short slots, short lines, short tokens)
+{
+    return std::to_string (slots) + "x" + std::to_string (lines) + "_" +
+           std::to_string (tokens) + TABLE_EXTENSION;
+}
+
+
+/******************************************************************************
+ *  @function   vSolve_Profile
+ *
+ *  @brief      Solves all positions of a height profile. Second player's
+ *              cells are enumerated in colex order (next set of same size
+ *              by Gosper's hack), so the entry just counts up.
+ *
+ *  @param      profile : Height profile number
+ *  @return     -
+ ******************************************************************************/
+
+void Tablebase::vSolve_Profile (unsigned long long profile)
+{
+    POSITION           pos;
+    unsigned long long cells[TABLE_CELLS_MAX];
+    unsigned long long occupied = 0;
+    short              n = 0;
+
+    pos.profile = profile;
+
+    for (short slot = 0; slot < siSlots; slot++, profile /= siLines + 1)
+    {
+        pos.heights[slot] = profile % (siLines + 1);
+
+        for (short line = 0; line < pos.heights[slot]; line++)
+            occupied |= cells[n++] = 1ULL << (slot * (siLines + 1) + line);
+    }
+    pos.tokens = n;
+
+    unsigned long long entry = pOffset[pos.profile];
+    unsigned long long count = ullBinomial (n, n / 2);
+
+    pos.mask = (1U << (n / 2)) - 1;
+
+    for (unsigned long long i = 0; i < count; i++, entry++)
+    {
+        short value = TABLE_DRAW;
+
+        pos.second = 0;
+        for (unsigned int m = pos.mask; m != 0; m &= m - 1)  pos.second |= cells[__builtin_ctz (m)];
+        pos.starter = occupied ^ pos.second;
+
+        if (bHas_Chain (pos.starter) || bHas_Chain (pos.second))
+        {
+            value = TABLE_INVALID;
+        }
+        else if (n < siSlots * siLines)
+        {
+            value = TABLE_LOSS;
+
+            for (short slot = 0; slot < siSlots && value != TABLE_WIN; slot++)
+            {
+                if (pos.heights[slot] == siLines) continue;
+
+                short move = siMove_Value (pos, slot);
+
+                if (move == TABLE_WIN || (move == TABLE_DRAW && value == TABLE_LOSS)) value = move;
+            }
+        }
+        vecValues[entry / 4] |= value << (entry % 4 * 2);
+
+        if (pos.mask != 0)
+        {
+            unsigned int low  = pos.mask & -pos.mask;
+            unsigned int high = pos.mask + low;
+
+            pos.mask = (((high ^ pos.mask) >> 2) / low) | high;
+        }
+    }
+}
+
+
+/******************************************************************************
+ *  @function   siMove_Value
+ *
+ *  @brief      Value of a move for the side to move: a move completing a
+ *              token chain wins, else the value of the position after
+ *              the move (one token more, already solved) is inverted
+ *
+ *  @param      pos  : Position without token chain
+ *              slot : Slot index of a free slot (0 ... slots - 1)
+ *  @return     TABLE_WIN, TABLE_DRAW or TABLE_LOSS
+ ******************************************************************************/
+
+short Tablebase::siMove_Value (const POSITION& pos, short slot) const
+{
+    unsigned long long token = 1ULL << (slot * (siLines + 1) + pos.heights[slot]);
+    unsigned long long mover = (pos.tokens % 2 == 0) ? pos.starter : pos.second;
+
+    if (bHas_Chain (mover | token)) return TABLE_WIN;
+
+    // New token becomes cell q of the cell order (slot by slot, bottom up)
+    unsigned long long radix = 1;
+    short              q     = pos.heights[slot];
+
+    for (short s = 0; s < slot; s++)  {q += pos.heights[s];  radix *= siLines + 1;}
+
+    unsigned int below = pos.mask & ((1U << q) - 1);
+    unsigned int mask  = below | (pos.mask & ~below) << 1 | (unsigned int)(pos.tokens % 2) << q;
+
+    short value = siValue (pOffset[pos.profile + radix] + ullRank (mask));
+
+    return value == TABLE_LOSS ? TABLE_WIN : value == TABLE_WIN ? TABLE_LOSS : TABLE_DRAW;
+}
+
+
+/******************************************************************************
+ *  @function   bEncode
+ *
+ *  @brief      Converts a game into the table's position format
+ *
+ *  @param      _oGameState : Game
+ *              pos         : Receives position
+ *  @return     bool        : false  if game is not covered by the table
+ ******************************************************************************/
+
+bool Tablebase::bEncode (const GameState& _oGameState, POSITION& pos) const
+{
+    if (!bCovers (_oGameState)) return false;
+
+    unsigned long long radix = 1;
+    short              n = 0, second = 0;
+
+    pos.starter = pos.second = 0;
+    pos.profile = 0;
+    pos.mask    = 0;
+
+    for (short slot = 0; slot < siSlots; slot++, radix *= siLines + 1)
+    {
+        pos.heights[slot] = _oGameState.siGet_SlotHeight (slot + 1);
+        pos.profile      += pos.heights[slot] * radix;
+
+        for (short line = 0; line < pos.heights[slot]; line++, n++)
+        {
+            unsigned long long bit = 1ULL << (slot * (siLines + 1) + line);
+
+            // Lines of the game state are counted from top
+            if (_oGameState.siGet_Field ({slot, (short)(siLines - 1 - line)}) == _oGameState.siGet_StartPlayer())
+            {
+                pos.starter |= bit;
+            }
+            else
+            {
+                pos.second |= bit;
+                pos.mask   |= 1U << n;
+                second++;
+            }
+        }
+    }
+    pos.tokens = n;
+
+    return second == n / 2;
+}
+
+
+/******************************************************************************
+ *  @function   siValue
+ *
+ *  @brief      Reads the 2 bit value of an entry
+ *
+ *  @param      entry : Entry number
+ *  @return     TABLE_INVALID ... TABLE_LOSS
+ ******************************************************************************/
+
+short Tablebase::siValue (unsigned long long entry) const
+{
+    return pValues[entry / 4] >> (entry % 4 * 2) & 3;
+}
+
+
+/******************************************************************************
+ *  @function   bHas_Chain
+ *
+ *  @brief      Checks a 64 bit board for a chain of tokens to win.
+ *              Slots are lines + 1 bits apart, the empty guard bit on
+ *              top of each slot stops chains running over slot borders.
+ *
+ *  @param      board : Tokens of one player
+ *  @return     bool  : true  if a chain is found in any direction
+ ******************************************************************************/
+
+bool Tablebase::bHas_Chain (unsigned long long board) const
+{
+    const short step[4] = {1, (short)(siLines + 1), siLines, (short)(siLines + 2)};
+
+    for (short dir = 0; dir < 4; dir++)
+    {
+        unsigned long long chain = board;
+
+        for (short i = 1; i < siTokens && chain != 0; i++)  chain &= board >> (step[dir] * i);
+
+        if (chain != 0) return true;
+    }
+    return false;
+}
+
+
+/******************************************************************************
+ *  @function   ullCount
+ *
+ *  @brief      Counts entries of a board size: per height profile with
+ *              n tokens all (n over n/2) sets of second player's cells,
+ *              rounded up to whole bytes
+ *
+ *  @param      slots, lines : Board size
+ *  @return     Number of entries
+ ******************************************************************************/
+
+unsigned long long Tablebase::ullCount (short slots, short lines)
+{
+    unsigned long long profiles = 1, count = 0;
+
+    for (short slot = 0; slot < slots; slot++)  profiles *= lines + 1;
+
+    for (unsigned long long profile = 0; profile < profiles; profile++)
+    {
+        short n = 0;
+
+        for (unsigned long long rest = profile; rest > 0; rest /= lines + 1)  n += rest % (lines + 1);
+
+        count = (count + ullBinomial (n, n / 2) + 3) & ~3ULL;
+    }
+    return count;
+}
@@ -0,0 +1,141 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Tablebase.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   Tablebase
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _TABLEBASE_H_
+#define _TABLEBASE_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <string>
+#include <vector>
+
+/*------  Module header includes  -------*/
+#include "RecordFile.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Tablebase file layout  ***
+ *
+ *  TABLE_HEADER
+ *  Offsets : First entry of each height profile (profiles + 1 values)
+ *  Values  : 2 bits per entry, 4 entries per byte (lowest bits first)
+ *  All values in host byte order (little endian).
+ */
+#define TABLE_MAGIC         "CF4T"
+#define TABLE_VERSION       1
+#define TABLE_EXTENSION     ".cf4t"
+#define TABLE_DIRECTORY     "tablebase"     // Default directory of machine player
+
+/***  Largest table, boards must fit into a 64 bit board with guard line  ***/
+#define TABLE_ENTRIES_MAX   (1ULL << 31)
+
+/***  Values of entries, seen by side to move  ***/
+#define TABLE_INVALID       0               // Position holds a token chain
+#define TABLE_WIN           1
+#define TABLE_DRAW          2
+#define TABLE_LOSS          3
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Perfect play for small boards. All positions with legal token
+ *  counts are solved backwards from the full board to the empty board,
+ *  one layer (number of tokens) at a time. A position is ranked without
+ *  collisions by its height profile (offset table) and the colex rank
+ *  of the cells holding tokens of the second player, so the table holds
+ *  only 2 bits per position and is read in place from a mapped file.  */
+
+class Tablebase
+{
+    public:
+    /** Types / Structs **/
+        typedef struct
+        {
+            char                magic[4];
+            unsigned int        version;
+            short               slots, lines, tokens, reserved;
+            unsigned long long  entries;
+            unsigned long long  profiles;
+        } TABLE_HEADER;
+
+    /** Constructor / Destructor **/
+                 Tablebase();
+        virtual ~Tablebase();
+
+    /** Getter / Setter **/
+        unsigned long long  ullGet_Entries  () const;
+        size_t              tGet_Size       () const;       // Bytes of file
+        short               siGet_Value     (const GameState& _oGameState) const;
+        short               siGet_BestMoves (const GameState& _oGameState, short* slots) const;
+
+        void                vSet_Threads    (short _siThreads);
+
+        static void             vSet_Directory  (const std::string& directory);
+        static const Tablebase* pFind           (const GameState& _oGameState);
+
+    /** Member functions / methods **/
+        bool    bGenerate       (short slots, short lines, short tokens);
+        bool    bWrite          (const std::string& path) const;
+        bool    bOpen           (const std::string& path);
+        bool    bCovers         (const GameState& _oGameState) const;
+
+        static bool         bSupported      (short slots, short lines, short tokens);
+        static std::string  sFile_Name      (short slots, short lines, short tokens);
+
+    private:
+    /** Types / Structs **/
+        typedef struct
+        {
+            unsigned long long  starter, second;    // Tokens as 64 bit boards
+            unsigned long long  profile;            // Height profile number
+            unsigned int        mask;               // Cells of second player
+            short               heights[BOARD_SLOTS_MAX];
+            short               tokens;
+        } POSITION;
+
+    /** Variables **/
+        short               siSlots, siLines, siTokens;
+        short               siThreads;
+        unsigned long long  ullProfiles;
+
+        std::vector<unsigned long long> vecOffset;     // Generated table
+        std::vector<unsigned char>      vecValues;
+        RecordFile                      oFile;         // Mapped table
+
+        const unsigned long long*   pOffset;
+        const unsigned char*        pValues;
+
+        static std::string  sDirectory;
+
+    /** Member functions / methods **/
+        void    vSolve_Profile  (unsigned long long profile);
+        short   siMove_Value    (const POSITION& pos, short slot) const;
+        bool    bEncode         (const GameState& _oGameState, POSITION& pos) const;
+        short   siValue         (unsigned long long entry) const;
+        bool    bHas_Chain      (unsigned long long board) const;
+
+        static unsigned long long ullCount (short slots, short lines);
+};
+
+#endif // _TABLEBASE_H_
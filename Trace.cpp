@@ -0,0 +1,240 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Trace.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Tracing
+ *           Registration of per-thread event buffers and export in
+ *           Chrome trace event format.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <algorithm>    // std::min
+#include <cstdlib>      // atexit
+#include <fstream>
+#include <iomanip>      // std::setprecision
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "Trace.hpp"
+
+/*=============================================================================
+=====                           LOCAL FUNCTIONS                           =====
+=============================================================================*/
+
+/*  Buffers of all threads and file written on exit. Never destroyed,
+ *  so objects destroyed on exit can still record.                    */
+
+struct TRACE_REGISTRY
+{
+    std::mutex                      oMutex;
+    std::vector<Trace::BUFFER*>     vecBuffers;
+    std::vector<Trace::BUFFER*>     vecFree;        // Of ended threads
+    unsigned long long              ullStart_Ticks = Trace::ullGet_Ticks();
+    unsigned long long              ullStart_Time  = Trace::ullGet_Time();
+    std::string                     sFile;
+};
+
+static TRACE_REGISTRY& tRegistry()
+{
+    static TRACE_REGISTRY* pRegistry = new TRACE_REGISTRY;
+
+    return *pRegistry;
+}
+
+
+/******************************************************************************
+ *  @function   vAppend_String
+ *
+ *  @brief      Writes a string as JSON string
+ *
+ *  @param      out : Stream
+ *              str : String
+ *  @return     -
+ ******************************************************************************/
+
+static void vAppend_String (std::ostream& out, const char* str)
+{
+    out << '"';
+    for (; *str != '\0'; str++)
+    {
+        if (*str == '"' || *str == '\\') out << '\\';
+        out << *str;
+    }
+    out << '"';
+}
+
+
+/******************************************************************************
+ *  @function   vWrite_OnExit
+ *
+ *  @brief      Writes the trace to the file set, called on exit
+ *  @param      -
+ *  @return     -
+ ******************************************************************************/
+
+static void vWrite_OnExit()
+{
+    Trace::bWrite (tRegistry().sFile);
+}
+
+/*=============================================================================
+=====                          STATIC VARIABLES                           =====
+=============================================================================*/
+
+thread_local Trace::BUFFER* Trace::pBuffer = NULL;
+
+static thread_local bool bReleased = false;     // Buffer owner of thread destroyed
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   vSet_File
+ *
+ *  @brief      Sets a file the trace is written to on exit
+ *
+ *  @param      path : Trace file (.json)
+ *  @return     -
+ ******************************************************************************/
+
+void Trace::vSet_File (const std::string& path)
+{
+    TRACE_REGISTRY& registry = tRegistry();
+
+    if (registry.sFile.empty()) atexit (vWrite_OnExit);
+    registry.sFile = path;
+}
+
+
+/******************************************************************************
+ *  @function   bWrite
+ *
+ *  @brief      Writes the events of all threads as Chrome trace (times
+ *              in microseconds since start of tracing, ticks converted
+ *              by the steady clock time passed meanwhile). Threads should
+ *              not record meanwhile, events being overwritten would be
+ *              torn.
+ *
+ *  @param      path : Trace file (.json)
+ *  @return     bool : false  if file can not be written
+ ******************************************************************************/
+
+bool Trace::bWrite (const std::string& path)
+{
+    TRACE_REGISTRY&              registry = tRegistry();
+    std::lock_guard<std::mutex>  oLock (registry.oMutex);
+    std::ofstream                file (path);
+    bool                         first = true;
+
+    if (!file) return false;
+
+    // Ticks per microsecond, measured over at least 10 ms
+    if (ullGet_Time() - registry.ullStart_Time < 10000000ULL)
+        std::this_thread::sleep_for (std::chrono::milliseconds (10));
+
+    double ticks_us = (ullGet_Ticks() - registry.ullStart_Ticks) * 1e3 / (ullGet_Time() - registry.ullStart_Time);
+
+    file << std::fixed << std::setprecision(3) << "{\"traceEvents\": [";
+
+    for (const BUFFER* buffer : registry.vecBuffers)
+    {
+        unsigned long long count = buffer->ullCount.load (std::memory_order_acquire);
+
+        file << (first ? "" : ",") << "\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": "
+             << buffer->uiThread << ", \"args\": {\"name\": \"thread " << buffer->uiThread << "\"}}";
+        first = false;
+
+        // Oldest kept event first
+        for (unsigned long long i = count - std::min (count, (unsigned long long)TRACE_BUFFER_EVENTS); i < count; i++)
+        {
+            const EVENT& event = buffer->aEvents[i % TRACE_BUFFER_EVENTS];
+
+            file << ",\n{\"name\": ";       vAppend_String (file, event.name);
+            file << ", \"cat\": ";          vAppend_String (file, event.category);
+            file << ", \"ts\": " << (event.start - std::min (event.start, registry.ullStart_Ticks)) / ticks_us;
+
+            if   (event.duration == TRACE_INSTANT) file << ", \"ph\": \"i\", \"s\": \"t\"";
+            else file << ", \"ph\": \"X\", \"dur\": " << event.duration / ticks_us;
+
+            file << ", \"pid\": 1, \"tid\": " << buffer->uiThread << "}";
+        }
+    }
+    file << "\n], \"displayTimeUnit\": \"ns\"}\n";
+
+    return (bool)file;
+}
+
+
+/******************************************************************************
+ *  @function   pRegister
+ *
+ *  @brief      Assigns a buffer to the calling thread on its first event:
+ *              one released by an ended thread, else a new one. The
+ *              buffer is released when the thread ends. Events recorded
+ *              after that (destructors on exit) get a buffer which is
+ *              not released again, at most one per thread.
+ *  @param      -
+ *  @return     pBuffer : Buffer of this thread
+ ******************************************************************************/
+
+Trace::BUFFER* Trace::pRegister()
+{
+    TRACE_REGISTRY& registry = tRegistry();
+
+    {
+        std::lock_guard<std::mutex> oLock (registry.oMutex);
+
+        if (!registry.vecFree.empty())
+        {
+            pBuffer = registry.vecFree.back();
+            registry.vecFree.pop_back();
+        }
+        else
+        {
+            pBuffer = new BUFFER;
+            pBuffer->ullCount.store (0);
+            pBuffer->uiThread = registry.vecBuffers.size() + 1;
+            registry.vecBuffers.push_back (pBuffer);
+        }
+    }
+
+    if (!bReleased)
+    {
+        static thread_local Owner oOwner;   // Constructed once per thread
+
+        (void)oOwner;
+    }
+    return pBuffer;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class Owner
+ *
+ *  @brief      Returns the buffer of the ending thread for reuse
+ ******************************************************************************/
+
+Trace::Owner::~Owner()
+{
+    TRACE_REGISTRY&             registry = tRegistry();
+    std::lock_guard<std::mutex> oLock (registry.oMutex);
+
+    registry.vecFree.push_back (pBuffer);
+    pBuffer   = NULL;
+    bReleased = true;
+}
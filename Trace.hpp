@@ -0,0 +1,186 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    Trace.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   Trace
+ *  @class   Span : Nested class within class Trace
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>  // __rdtsc
+#endif
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Events kept per thread, older events are overwritten  ***/
+#define TRACE_BUFFER_EVENTS (1 << 15)
+
+/***  Duration of an instant event  ***/
+#define TRACE_INSTANT       (~0ULL)
+
+/***  Trace points (spans of a scope, instant events), no code if  ***/
+/***  not defined; written with trailing option  --trace <file>     ***/
+//#define TRACE
+
+#ifdef  TRACE
+        #define TRACE_JOIN(a, b)                a##b
+        #define TRACE_SCOPE(line)               TRACE_JOIN(oTrace_Span_, line)
+        #define TRACE_SPAN(category, name)      Trace::Span TRACE_SCOPE(__LINE__) (category, name)
+        #define TRACE_EVENT(category, name)     Trace::vEvent (category, name)
+#else
+        #define TRACE_SPAN(category, name)
+        #define TRACE_EVENT(category, name)
+#endif // TRACE
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Records spans and instant events into one ring buffer per thread and
+ *  exports them in Chrome trace event format (Perfetto, chrome://tracing).
+ *  Only the owning thread writes a buffer, so recording takes no lock:
+ *  an event is a clock read and four stores. On x86 the clock is the
+ *  time stamp counter, converted to time on export by the steady
+ *  clock; elsewhere it is the steady clock itself. The buffer of an
+ *  ended thread goes to the next new thread, its events are kept until
+ *  overwritten; memory thus follows the threads recording at the same
+ *  time, not all threads ever started. Names and categories must be
+ *  string literals (only pointers are stored). Trace points are the
+ *  TRACE_SPAN and TRACE_EVENT macros, empty unless TRACE is defined.  */
+
+class Trace
+{
+    public:
+    /** Types / Structs **/
+        typedef struct
+        {
+            const char*         name;
+            const char*         category;
+            unsigned long long  start;      // Ticks
+            unsigned long long  duration;   // Ticks, TRACE_INSTANT for events
+        } EVENT;
+
+        typedef struct
+        {
+            EVENT                               aEvents[TRACE_BUFFER_EVENTS];
+            std::atomic<unsigned long long>     ullCount;   // Events written
+            unsigned int                        uiThread;   // Thread number in trace
+        } BUFFER;
+
+    /** Nested class **/
+        class Span
+        {
+            public:
+            /** Constructor / Destructor **/
+                Span (const char* category, const char* name);
+                ~Span();
+
+            private:
+            /** Variables **/
+                const char*         pCategory;
+                const char*         pName;
+                unsigned long long  ullStart;
+        };
+
+    /** Getter / Setter **/
+        static unsigned long long   ullGet_Ticks();
+        static unsigned long long   ullGet_Time ();
+        static void                 vSet_File   (const std::string& path);
+
+    /** Member functions / methods **/
+        static void     vRecord     (const char* category, const char* name,
+                                     unsigned long long start, unsigned long long duration);
+        static void     vEvent      (const char* category, const char* name);
+        static bool     bWrite      (const std::string& path);
+
+    private:
+    /** Nested class **/
+        class Owner                 // Releases buffer of its thread on thread end
+        {
+            public:
+            /** Destructor **/
+                ~Owner();
+        };
+
+    /** Member functions / methods **/
+        static BUFFER*  pRegister   ();
+
+    /** Variables **/
+        static thread_local BUFFER* pBuffer;    // Of this thread
+};
+
+/*** Recording, inline as it runs at every trace point ***/
+inline unsigned long long Trace::ullGet_Time()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds> (
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline unsigned long long Trace::ullGet_Ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return ullGet_Time();
+#endif
+}
+
+inline void Trace::vRecord (const char* category, const char* name,
+                            unsigned long long start, unsigned long long duration)
+{
+    BUFFER*            buffer = (pBuffer != NULL) ? pBuffer : pRegister();
+    unsigned long long count  = buffer->ullCount.load (std::memory_order_relaxed);
+    EVENT&             event  = buffer->aEvents[count % TRACE_BUFFER_EVENTS];
+
+    event.name     = name;
+    event.category = category;
+    event.start    = start;
+    event.duration = duration;
+
+    // Export reads the events below the count
+    buffer->ullCount.store (count + 1, std::memory_order_release);
+}
+
+inline void Trace::vEvent (const char* category, const char* name)
+{
+    vRecord (category, name, ullGet_Ticks(), TRACE_INSTANT);
+}
+
+inline Trace::Span::Span (const char* category, const char* name)
+{
+    pCategory = category;
+    pName     = name;
+    ullStart  = ullGet_Ticks();
+}
+
+inline Trace::Span::~Span()
+{
+    vRecord (pCategory, pName, ullStart, ullGet_Ticks() - ullStart);
+}
+
+#endif // _TRACE_H_
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    TraceBench.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Tracing benchmark
+ *           Reports the recording cost of a trace point.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <chrono>       // steady_clock
+#include <iostream>
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "TraceBench.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class TraceBench
+ *
+ *  @brief      Instantiates a TraceBench object
+ *  @param      -
+ ******************************************************************************/
+
+TraceBench::TraceBench()
+{
+    DEBUG_CONSTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class TraceBench
+ *
+ *  @brief      Destroys this TraceBench object
+ ******************************************************************************/
+
+TraceBench::~TraceBench()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   vRun
+ *
+ *  @brief      Records half of the events as spans, half as instant
+ *              events and prints the time per event
+ *
+ *  @param      events : Number of events
+ *  @return     -
+ ******************************************************************************/
+
+void TraceBench::vRun (long events)
+{
+    auto tStart = std::chrono::steady_clock::now();
+
+    for (long i = 0; i < events / 2; i++)
+    {
+        TRACE_SPAN  ("bench", "span");
+        TRACE_EVENT ("bench", "event");
+    }
+    std::chrono::duration<double> tTime = std::chrono::steady_clock::now() - tStart;
+
+#ifdef  TRACE
+    std::cout << "  " << tTime.count() * 1e9 / events << " ns per event" << std::endl;
+#else
+    std::cout << "  Trace points not built in, " << tTime.count() * 1e9 / events << " ns per event" << std::endl;
+#endif // TRACE
+}
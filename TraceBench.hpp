@@ -0,0 +1,41 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    TraceBench.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   TraceBench
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _TRACEBENCH_H_
+#define _TRACEBENCH_H_
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Tracing benchmark. Records spans and instant events in a tight loop
+ *  and reports the cost per event, the cost of an empty loop if trace
+ *  points are not built in.                                           */
+
+class TraceBench
+{
+    public:
+    /** Constructor / Destructor **/
+                 TraceBench();
+        virtual ~TraceBench();
+
+    /** Member functions / methods **/
+        virtual void    vRun        (long events);
+};
+
+#endif // _TRACEBENCH_H_
@@ -0,0 +1,259 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    WindowEval.cpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @brief   Window evaluation
+ *           Incrementally kept token counts of all windows of win token
+ *           length, for score, open threats and winner of a position.
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  System interface includes  -------*/
+#include <cstring>      // std::memset
+
+/*------  Module includes  -------*/
+#include "main.hpp"
+#include "WindowEval.hpp"
+
+/*=============================================================================
+=====                         FUNCTIONS / METHODS                         =====
+=============================================================================*/
+
+/******************************************************************************
+ *  @function   Constructor of class WindowEval
+ *
+ *  @brief      Instantiates a WindowEval object of the default game
+ *  @param      -
+ ******************************************************************************/
+
+WindowEval::WindowEval()
+{
+    DEBUG_CONSTRUCTOR;
+
+    siSlots = siLines = siTokens = 0;
+    vSet_Game (GameState());
+}
+
+
+/******************************************************************************
+ *  @function   Destructor of class WindowEval
+ *
+ *  @brief      Destroys this WindowEval object
+ ******************************************************************************/
+
+WindowEval::~WindowEval()
+{
+    DEBUG_DESTRUCTOR;
+}
+
+
+/******************************************************************************
+ *  @function   llGet_Score
+ *
+ *  @brief      Returns the score of the position: windows of player 1
+ *              count positive, windows of player 2 negative
+ *  @param      -
+ *  @return     llScore : Score, EVAL_WIN_SCORE per completed window
+ ******************************************************************************/
+
+long long WindowEval::llGet_Score() const
+{
+    return llScore;
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Threats
+ *
+ *  @brief      Returns open threats of a player: windows missing one
+ *              token, with the last cell free
+ *
+ *  @param      player : PLAYER_1_ID or PLAYER_2_ID
+ *  @return     Number of windows
+ ******************************************************************************/
+
+short WindowEval::siGet_Threats (short player) const
+{
+    return aThreats[player == PLAYER_2_ID];
+}
+
+
+/******************************************************************************
+ *  @function   siGet_Winner
+ *
+ *  @brief      Returns the player with a completed window
+ *  @param      -
+ *  @return     PLAYER_1_ID, PLAYER_2_ID, zero if no window is completed
+ ******************************************************************************/
+
+short WindowEval::siGet_Winner() const
+{
+    return aWins[0] > 0 ? PLAYER_1_ID : aWins[1] > 0 ? PLAYER_2_ID : 0;
+}
+
+
+/******************************************************************************
+ *  @function   liGet_Windows
+ *
+ *  @brief      Returns the number of windows of the board
+ *  @param      -
+ *  @return     Number of windows
+ ******************************************************************************/
+
+long WindowEval::liGet_Windows() const
+{
+    return liWindows;
+}
+
+
+/******************************************************************************
+ *  @function   vSet_Game
+ *
+ *  @brief      Takes over rules and position of a game. Windows are
+ *              taken from the line table of the win tokens.
+ *
+ *  @param      _oGameState : Game
+ *  @return     -
+ ******************************************************************************/
+
+void WindowEval::vSet_Game (const GameState& _oGameState)
+{
+    GameState::BOARD size = _oGameState.tGet_BoardSize();
+
+    if (size.slot != siSlots || size.line != siLines || _oGameState.siGet_WinTokens() != siTokens)
+    {
+        siSlots  = size.slot;
+        siLines  = size.line;
+        siTokens = _oGameState.siGet_WinTokens();
+        pLines   = LineTable::pGet_Lines (siTokens);
+
+        liWindows = 0;
+        for (long i = 0; i < LineTable::liCount (siTokens); i++)
+            if (LineTable::bFits (pLines[i], siSlots, siLines)) liWindows++;
+
+        aWeight[0] = 0;
+        for (short tokens = 1; tokens < siTokens; tokens++)  aWeight[tokens] = 1LL << (EVAL_WEIGHT_SHIFT * (tokens - 1));
+        aWeight[siTokens] = EVAL_WIN_SCORE;
+    }
+
+    std::memset (aWindows, 0, sizeof(aWindows));
+    std::memset (aOwner,   0, sizeof(aOwner));
+    std::memset (aHeight,  0, sizeof(aHeight));
+    llScore     = 0;
+    aThreats[0] = aThreats[1] = 0;
+    aWins[0]    = aWins[1]    = 0;
+
+    // Lines of the game state are counted from top
+    for (short slot = 0; slot < siSlots; slot++)
+        for (short line = 0; line < _oGameState.siGet_SlotHeight (slot + 1); line++)
+            bPlay_Move (slot + 1, _oGameState.siGet_Field ({slot, (short)(siLines - 1 - line)}));
+}
+
+
+/******************************************************************************
+ *  @function   bPlay_Move
+ *
+ *  @brief      Puts a token of a player into a slot
+ *
+ *  @param      slot   : Slot number (1 ... slots)
+ *              player : PLAYER_1_ID or PLAYER_2_ID
+ *  @return     bool   : false  if slot is full or invalid
+ ******************************************************************************/
+
+bool WindowEval::bPlay_Move (short slot, short player)
+{
+    if (slot < 1 || slot > siSlots || aHeight[slot - 1] >= siLines) return false;
+
+    short line = aHeight[--slot]++;
+
+    aOwner[slot][line] = player;
+    vUpdate (slot, line, player, 1);
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   bUndo_Move
+ *
+ *  @brief      Takes back the top token of a slot
+ *
+ *  @param      slot : Slot number (1 ... slots)
+ *  @return     bool : false  if slot is empty or invalid
+ ******************************************************************************/
+
+bool WindowEval::bUndo_Move (short slot)
+{
+    if (slot < 1 || slot > siSlots || aHeight[slot - 1] == 0) return false;
+
+    short line = --aHeight[--slot];
+
+    vUpdate (slot, line, aOwner[slot][line], -1);
+    aOwner[slot][line] = 0;
+
+    return true;
+}
+
+
+/******************************************************************************
+ *  @function   vUpdate
+ *
+ *  @brief      Adds or removes a token in all windows through its cell
+ *
+ *  @param      slot, line : Cell (indexes, lines from bottom)
+ *              player     : Owner of the token
+ *              step       : 1 to add, -1 to remove
+ *  @return     -
+ ******************************************************************************/
+
+void WindowEval::vUpdate (short slot, short line, short player, short step)
+{
+    short count;
+    const unsigned short* index = LineTable::pGet_CellLines (siTokens, slot, line, count);
+
+    for (short i = 0; i < count; i++)
+    {
+        if (!LineTable::bFits (pLines[index[i]], siSlots, siLines)) continue;
+
+        WINDOW& window = aWindows[index[i]];
+
+        vCount (window, -1);
+        window.count[player == PLAYER_2_ID] += step;
+        vCount (window, 1);
+    }
+}
+
+
+/******************************************************************************
+ *  @function   vCount
+ *
+ *  @brief      Adds or removes a window from score, threats and wins
+ *
+ *  @param      window : Window
+ *              sign   : 1 to add, -1 to remove
+ *  @return     -
+ ******************************************************************************/
+
+void WindowEval::vCount (const WINDOW& window, short sign)
+{
+    const short p1 = window.count[0], p2 = window.count[1];
+
+    if (p1 > 0 && p2 > 0) return;       // Dead window
+
+    llScore += sign * (aWeight[p1] - aWeight[p2]);
+
+    if (p1 == siTokens - 1) aThreats[0] += sign;
+    if (p2 == siTokens - 1) aThreats[1] += sign;
+    if (p1 == siTokens)     aWins[0]    += sign;
+    if (p2 == siTokens)     aWins[1]    += sign;
+}
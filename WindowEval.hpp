@@ -0,0 +1,93 @@
+/******************************************************************************
+ *
+ *  @project Connect Four
+ *
+ *  @file    WindowEval.hpp
+ *
+ *  @date    2026-10-19
+ *
+ *  @author  Arthur Ackermann
+ *
+ *  @class   WindowEval
+ *
+ ******************************************************************************/
+
+/*=============================================================================
+=====                         SET OWN MODULE ID                           =====
+=============================================================================*/
+
+#ifndef _WINDOWEVAL_H_
+#define _WINDOWEVAL_H_
+
+/*=============================================================================
+=====                              INCLUDES                               =====
+=============================================================================*/
+
+/*------  Module header includes  -------*/
+#include "GameState.hpp"
+#include "LineTable.hpp"
+
+/*=============================================================================
+=====                           MACROS / INLINES                          =====
+=============================================================================*/
+
+/***  Score of a window held by one player only: 4^(tokens - 1)  ***/
+#define EVAL_WEIGHT_SHIFT   2
+#define EVAL_WIN_SCORE      (1LL << 48)     // Completed window
+
+/*=============================================================================
+=====                               CLASSES                               =====
+=============================================================================*/
+
+/*  Evaluation state of a position: token counts of both players in
+ *  every window of win token length (all chains that can still be
+ *  completed). Windows are the lines of LineTable fitting into the
+ *  board, kept at their frame index. A move only updates the windows
+ *  through its cell, so score, open threats and winner are known
+ *  without scanning the board. Windows holding tokens of both players
+ *  are dead and do not count.                                         */
+
+class WindowEval
+{
+    public:
+    /** Constructor / Destructor **/
+                 WindowEval();
+        virtual ~WindowEval();
+
+    /** Getter / Setter **/
+        long long   llGet_Score     () const;
+        short       siGet_Threats   (short player) const;
+        short       siGet_Winner    () const;
+        long        liGet_Windows   () const;
+
+    /** Member functions / methods **/
+        void    vSet_Game       (const GameState& _oGameState);
+        bool    bPlay_Move      (short slot, short player);
+        bool    bUndo_Move      (short slot);
+
+    private:
+    /** Types / Structs **/
+        typedef struct {unsigned char count[2];} WINDOW;      // Tokens per player
+
+    /** Variables **/
+        short               siSlots, siLines, siTokens;
+
+        const LineTable::LINE*  pLines;     // Frame lines of win tokens
+        long                liWindows;      // Lines fitting into the board
+
+        WINDOW              aWindows[LineTable::liCount (WIN_TOKENS_MIN)];   // Per frame line
+
+        unsigned char       aOwner  [BOARD_SLOTS_MAX][BOARD_LINES_MAX];   // Lines from bottom
+        unsigned char       aHeight [BOARD_SLOTS_MAX];
+        long long           aWeight [BOARD_LINES_MAX + 1];  // Score per tokens
+
+        long long           llScore;        // Seen by player 1
+        short               aThreats[2];    // Windows missing one token
+        short               aWins   [2];    // Completed windows
+
+    /** Member functions / methods **/
+        void    vUpdate         (short slot, short line, short player, short step);
+        void    vCount          (const WINDOW& window, short sign);
+};
+
+#endif // _WINDOWEVAL_H_
@@ -17,7 +17,12 @@
 =============================================================================*/
 
 /*------  System interface includes  -------*/
+#include <chrono>
+#include <cstdio>       // std::sscanf
+#include <cstdlib>
 #include <iostream>
+#include <string>
+#include <vector>
 
 /*------  Module header includes  -------*/
 #include "main.hpp"
@@ -30,13 +35,341 @@
  *  @function   main
  *
  *  @brief      Instantiates the main Game object in order to start the game
+ *              or runs headless machine against machine games:
  *
- *  @param      -
+ *              ConnectFour [--turbo]   : No delays and animations
+ *                                        (scripted sessions)
+ *              ConnectFour --selfplay <games> [<parallel games>]
+ *
+ *              Both append finished games to a game record file with
+ *              trailing option  --record <file>
+ *
+ *              Any command writes a Chrome trace on exit with trailing
+ *              option  --trace <file>  (after  --record)  if built with
+ *              TRACE; the recording cost is measured with:
+ *
+ *              ConnectFour --bench-trace [<events>]
+ *
+ *              Any command shows the latency histograms of the turns on
+ *              exit and writes them with trailing option  --latency <file>
+ *              (after  --trace; .prom or .txt Prometheus text, else JSON)
+ *
+ *              or scans game record files (optionally replaying every game):
+ *
+ *              ConnectFour --scan [--replay] <file> [<file> ...]
+ *
+ *              or builds / queries an opening index of game record files
+ *              (moves of standard board as slot digits 1 ... 7):
+ *
+ *              ConnectFour --index-build <index> <file> [<file> ...]
+ *              ConnectFour --explore <index> [<moves>]
+ *
+ *              or generates tablebases into a directory (default: all of
+ *              4x4, 5x4, 5x5 with 3 and 4 tokens to win); the machine
+ *              player plays perfectly on tables in directory "tablebase":
+ *
+ *              ConnectFour --tablebase <dir> [<slots>x<lines>x<tokens> ...]
+ *
+ *              or solves a position split into units of a queue directory,
+ *              optionally starting local worker processes; workers on
+ *              other machines share the directory:
+ *
+ *              ConnectFour --solve <slots>x<lines>x<tokens> <dir> <depth> [<workers>]
+ *              ConnectFour --solve-worker <dir>
+ *
+ *              or solves a position after moves (slot digits) by alpha-beta
+ *              without and with rules and by proof-number search, showing
+ *              the work of each (and search statistics as JSON if built
+ *              with SEARCH_STATS):
+ *
+ *              ConnectFour --prove <slots>x<lines>x<tokens> [<moves>]
+ *
+ *              or measures rendering on the mock console:
+ *
+ *              ConnectFour --bench-render [<games per board size>]
+ *              ConnectFour --bench-screen <slots> <lines>
+ *
+ *              or compares winner checks by full board scans against the
+ *              incremental window evaluation on random games:
+ *
+ *              ConnectFour --bench-eval [<games per board size>]
+ *
+ *              or plays random games on sparse boards up to 4096x4096,
+ *              winners checked on the fields and against the game state
+ *              where it holds the board:
+ *
+ *              ConnectFour --bench-sparse [<games per board size>]
+ *
+ *  @param      argc : Number of command line arguments
+ *              argv : Command line arguments
  ******************************************************************************/
 
-int main()
+int main (int argc, char* argv[])
 {
-    Game oGame;     // Start and init game
+    // Static, so buffered records are written on exit() too
+    static RecordWriter oRecorder;
+    RecordWriter*       pRecorder = NULL;
+
+    /***  Turn latencies  ***/
+    if (argc >= 3 && std::string (argv[argc - 2]) == "--latency")
+    {
+        Latency::vSet_File (argv[argc - 1]);
+        argc -= 2;
+    }
+
+    /***  Tracing  ***/
+    if (argc >= 3 && std::string (argv[argc - 2]) == "--trace")
+    {
+#ifndef TRACE
+        std::cerr << "Trace points not built in (TRACE in Trace.hpp)" << std::endl;
+#endif // TRACE
+        Trace::vSet_File (argv[argc - 1]);
+        argc -= 2;
+    }
+
+    /***  Game recording  ***/
+    if (argc >= 3 && std::string (argv[argc - 2]) == "--record")
+    {
+        if (!oRecorder.bOpen (argv[argc - 1]))
+        {
+            std::cerr << "Can not open record file " << argv[argc - 1] << std::endl;
+            return 1;
+        }
+        pRecorder = &oRecorder;
+        argc -= 2;
+    }
+
+    /***  Headless self-play  ***/
+    if (argc >= 3 && std::string (argv[1]) == "--selfplay")
+    {
+        Scheduler oScheduler;
+
+        oScheduler.vSet_Recorder (pRecorder);
+        oScheduler.vRun_SelfPlay (GameState(), std::atol (argv[2]),
+                                  argc >= 4 ? std::atoi (argv[3]) : 1);
+        oScheduler.vShow_Results();
+
+        return 0;
+    }
+
+    /***  Game record statistics  ***/
+    if (argc >= 3 && std::string (argv[1]) == "--scan")
+    {
+        ArchiveScanner oScanner;
+        int            first = 2;
+
+        if (std::string (argv[2]) == "--replay") {oScanner.vSet_Replay (true);  first = 3;}
+
+        for (int i = first; i < argc; i++)
+        {
+            if (!oScanner.bScan (argv[i]))
+                std::cerr << "Can not scan record file " << argv[i] << " completely" << std::endl;
+        }
+        oScanner.vShow_Results();
+
+        return 0;
+    }
+
+    /***  Opening index  ***/
+    if (argc >= 4 && std::string (argv[1]) == "--index-build")
+    {
+        OpeningIndex oIndex;
+
+        if (!oIndex.bBuild (std::vector<std::string> (argv + 3, argv + argc), argv[2], BOARD_FIELDS_MAX))
+        {
+            std::cerr << "Can not build index " << argv[2] << " completely" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    if (argc >= 3 && std::string (argv[1]) == "--explore")
+    {
+        OpeningIndex oIndex;
+        GameState    oGameState;
+
+        if (!oIndex.bOpen (argv[2]))
+        {
+            std::cerr << "Can not open index " << argv[2] << std::endl;
+            return 1;
+        }
+        for (const char* move = argc >= 4 ? argv[3] : ""; *move != '\0'; move++)
+        {
+            if (!oGameState.bPlay_Move (*move - '0'))
+            {
+                std::cerr << "Invalid move " << *move << std::endl;
+                return 1;
+            }
+        }
+        oIndex.vShow_Query (oGameState);
+
+        return 0;
+    }
+
+    /***  Tablebase generation  ***/
+    if (argc >= 3 && std::string (argv[1]) == "--tablebase")
+    {
+        std::vector<std::string> vecConfigs (argv + 3, argv + argc);
+
+        if (vecConfigs.empty())
+            vecConfigs = {"4x4x3", "4x4x4", "5x4x3", "5x4x4", "5x5x3", "5x5x4"};
+
+        for (const std::string& config : vecConfigs)
+        {
+            Tablebase oTable;
+            GameState oGameState;
+            int       slots = 0, lines = 0, tokens = 0;
+
+            std::sscanf (config.c_str(), "%dx%dx%d", &slots, &lines, &tokens);
+
+            auto tStart = std::chrono::steady_clock::now();
+
+            if (!oTable.bGenerate (slots, lines, tokens) ||
+                !oTable.bWrite (std::string (argv[2]) + "/" + Tablebase::sFile_Name (slots, lines, tokens)))
+            {
+                std::cerr << "Can not generate tablebase " << config << std::endl;
+                continue;
+            }
+
+            std::chrono::duration<double> tTime = std::chrono::steady_clock::now() - tStart;
+            static const char* VALUE[4] = {"-", "win", "draw", "loss"};
+
+            oGameState.vSet_BoardSize  ({(short)slots, (short)lines});
+            oGameState.vSet_WinTokens  (tokens);
+
+            std::cout << "  " << config << " : " << oTable.ullGet_Entries() << " entries, "
+                      << oTable.tGet_Size() << " bytes, " << tTime.count() << " s, start player "
+                      << VALUE[oTable.siGet_Value (oGameState)] << std::endl;
+        }
+        return 0;
+    }
+
+    /***  Distributed solving  ***/
+    if (argc >= 5 && std::string (argv[1]) == "--solve")
+    {
+        DistSolver oSolver;
+        GameState  oGameState;
+        int        slots = 0, lines = 0, tokens = 0;
+
+        std::sscanf (argv[2], "%dx%dx%d", &slots, &lines, &tokens);
+        oGameState.vSet_BoardSize  ({(short)slots, (short)lines});
+        oGameState.vSet_WinTokens  (tokens);
+
+        oSolver.vSet_Program (argv[0]);
+        if (oSolver.siSolve (oGameState, argv[3], std::atoi (argv[4]),
+                             argc >= 6 ? std::atoi (argv[5]) : 1) == SOLVE_UNKNOWN)
+        {
+            std::cerr << "Can not solve " << argv[2] << " in " << argv[3] << std::endl;
+            return 1;
+        }
+        oSolver.vShow_Results();
+
+        return 0;
+    }
+    if (argc >= 3 && std::string (argv[1]) == "--solve-worker")
+    {
+        DistSolver oSolver;
+
+        return oSolver.bRun_Worker (argv[2]) ? 0 : 1;
+    }
+    if (argc >= 3 && std::string (argv[1]) == "--prove")
+    {
+        static const char* VALUE[4] = {"loss", "draw", "win", "unknown"};
+
+        Solver      oPlain, oSolver;
+        ProofSolver oProver;
+        GameState   oGameState;
+        int         slots = 0, lines = 0, tokens = 0;
+
+        std::sscanf (argv[2], "%dx%dx%d", &slots, &lines, &tokens);
+        oGameState.vSet_BoardSize  ({(short)slots, (short)lines});
+        oGameState.vSet_WinTokens  (tokens);
+
+        for (const char* move = argc >= 4 ? argv[3] : ""; *move != '\0'; move++)
+        {
+            if (!oGameState.bPlay_Move (*move - '0'))
+            {
+                std::cerr << "Invalid move " << *move << std::endl;
+                return 1;
+            }
+        }
+
+        oPlain.vSet_Rules (false);
+
+        for (Solver* pSolver : {&oPlain, &oSolver, (Solver*)&oProver})
+        {
+            auto  tStart = std::chrono::steady_clock::now();
+            short value  = pSolver->siSolve (oGameState);
+
+            std::chrono::duration<double> tTime = std::chrono::steady_clock::now() - tStart;
+
+            std::cout << "  " << (pSolver == &oPlain  ? "Alpha-beta, no rules " :
+                                  pSolver == &oSolver ? "Alpha-beta           " : "Proof-number         ") << ": "
+                      << VALUE[value + 1] << ", " << pSolver->llGet_Nodes() << " positions";
+            if (pSolver == &oProver)
+                std::cout << ", proof " << oProver.llGet_ProofSize() << " positions, "
+                          << oProver.llGet_Collections() << " collections";
+            std::cout << ", " << tTime.count() << " s" << std::endl;
+            STATS (std::cout << "    " << Solver::sGet_Json (pSolver->tGet_Stats()) << std::endl);
+
+            if (value == SOLVE_UNKNOWN) return 1;
+        }
+        return 0;
+    }
+
+    /***  Rendering benchmark, golden screen  ***/
+    if (argc >= 2 && std::string (argv[1]) == "--bench-render")
+    {
+        ConsoleControl::vSet_Mock (true);
+        RenderBench oBench;
+
+        oBench.vRun (argc >= 3 ? std::atol (argv[2]) : 100);
+
+        return 0;
+    }
+    if (argc >= 4 && std::string (argv[1]) == "--bench-screen")
+    {
+        ConsoleControl::vSet_Mock (true);
+        RenderBench oBench;
+
+        oBench.vShow_Screen (std::atoi (argv[2]), std::atoi (argv[3]));
+
+        return 0;
+    }
+
+    /***  Evaluation benchmark  ***/
+    if (argc >= 2 && std::string (argv[1]) == "--bench-eval")
+    {
+        EvalBench oBench;
+
+        oBench.vRun (argc >= 3 ? std::atol (argv[2]) : 1000);
+
+        return 0;
+    }
+
+    /***  Tracing benchmark  ***/
+    if (argc >= 2 && std::string (argv[1]) == "--bench-trace")
+    {
+        TraceBench oBench;
+
+        oBench.vRun (argc >= 3 ? std::atol (argv[2]) : 10000000);
+
+        return 0;
+    }
+
+    /***  Sparse board benchmark  ***/
+    if (argc >= 2 && std::string (argv[1]) == "--bench-sparse")
+    {
+        SparseBench oBench;
+
+        oBench.vRun (argc >= 3 ? std::atol (argv[2]) : 100);
+
+        return 0;
+    }
+
+    if (argc >= 2 && std::string (argv[1]) == "--turbo")
+        ConsoleControl::vSet_Turbo (true);
+
+    Game oGame (pRecorder);     // Start and init game
 
-    return 0;
+    return 0;
 }
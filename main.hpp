@@ -24,7 +24,23 @@
 =============================================================================*/
 
 /*------  Module header includes  -------*/
+#include "ArchiveScanner.hpp"
+#include "DistSolver.hpp"
+#include "EvalBench.hpp"
 #include "Game.hpp"
+#include "Latency.hpp"
+#include "LineTable.hpp"
+#include "OpeningIndex.hpp"
+#include "ProofSolver.hpp"
+#include "RenderBench.hpp"
+#include "Scheduler.hpp"
+#include "Solver.hpp"
+#include "SparseBench.hpp"
+#include "SparseBoard.hpp"
+#include "Tablebase.hpp"
+#include "Trace.hpp"
+#include "TraceBench.hpp"
+#include "WindowEval.hpp"
 
 /*=============================================================================
 =====                           MACROS / INLINES                          =====
@@ -33,24 +49,27 @@
 /***  Program version  ***/
 #define  VERSION  "v0.1"
 
-/***  Debug info for constructor/destructor calls  ***/
-//#define DEBUG
+/***  Constructor/destructor calls as trace events  ***/
+#define DEBUG_CONSTRUCTOR   TRACE_EVENT ("constructor", __PRETTY_FUNCTION__)
+#define DEBUG_DESTRUCTOR    TRACE_EVENT ("destructor",  __PRETTY_FUNCTION__)
 
-#ifdef  DEBUG
-        #define DEBUG_CONSTRUCTOR std::cout << "-> Constructor:  " << __PRETTY_FUNCTION__ << "\n"
-        #define DEBUG_DESTRUCTOR  std::cout << "-> Constructor:  " << __PRETTY_FUNCTION__ << "\n"
+/***  Search statistics of the solvers, without counting code if  ***/
+/***  not defined                                                 ***/
+//#define SEARCH_STATS
+
+#ifdef  SEARCH_STATS
+        #define STATS(statement)  statement
 #else
-        #define DEBUG_CONSTRUCTOR
-        #define DEBUG_DESTRUCTOR
-#endif // DEBUG
+        #define STATS(statement)
+#endif // SEARCH_STATS
 
 
 /***  Halts program and prints "request for key  ***/
 /***  press to continue" to first line           ***/
 #define PAUSE  {COORD curpos_tmp;   \
                 curpos_tmp = tCurPos_Get(); \
-                vCurPos_Set({0, 0});  system("PAUSE"); \
-                vCurPos_Set({0, 0});  std::cout << "                                              "; \
+                vCurPos_Set({0, 0});  vFlush();  system("PAUSE"); \
+                vCurPos_Set({0, 0});  oScreen << "                                              "; \
                 vCurPos_Set(curpos_tmp);}
 
 